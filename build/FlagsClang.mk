@@ -106,6 +106,11 @@ ESCARGOT_LDFLAGS_LTO += -flto
 #######################################################
 ESCARGOT_CXXFLAGS_VENDORTEST += -DESCARGOT_ENABLE_VENDORTEST
 
+#######################################################
+# flags for THREADING
+#######################################################
+ESCARGOT_CXXFLAGS_THREADING += -DESCARGOT_THREADING -DGC_THREADS
+
 #######################################################
 # flags for $(THIRD_PARTY)
 #######################################################
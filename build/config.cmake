@@ -232,3 +232,6 @@ SET (ESCARGOT_LDFLAGS_STATICLIB -Wl,--gc-sections)
 # FLAGS FOR TEST
 #######################################################
 SET (ESCARGOT_DEFINITIONS_VENDORTEST -DESCARGOT_ENABLE_VENDORTEST)
+
+# one VMInstance per thread. bdwgc should be built with thread support too
+SET (ESCARGOT_DEFINITIONS_THREADING -DESCARGOT_THREADING -DGC_THREADS)
@@ -103,6 +103,10 @@ IF (${VENDORTEST})
     SET (ESCARGOT_DEFINITIONS ${ESCARGOT_DEFINITIONS} ${ESCARGOT_DEFINITIONS_VENDORTEST})
 ENDIF()
 
+IF (${ESCARGOT_THREADING})
+    SET (ESCARGOT_DEFINITIONS ${ESCARGOT_DEFINITIONS} ${ESCARGOT_DEFINITIONS_THREADING})
+ENDIF()
+
 
 # SOURCE FILES
 FILE (GLOB_RECURSE ESCARGOT_SRC ${ESCARGOT_ROOT}/src/*.cpp)
@@ -120,55 +124,69 @@ SET (ESCARGOT_SRC_LIST
 )
 
 
-# GC LIBRARY (static) only for binary output
-IF (${ESCARGOT_OUTPUT} STREQUAL "bin")
-    SET (GC_CFLAGS_COMMON "-g3 -fdata-sections -ffunction-sections -DHAVE_CONFIG_H -DESCARGOT -DIGNORE_DYNAMIC_LOADING -DGC_DONT_REGISTER_MAIN_STATIC_DATA -Wno-unused-variable")
+# GC LIBRARY
+# binary output links it statically. library outputs only build it, with the same threading
+# configuration as Escargot, so embedders can link GC which matches ESCARGOT_THREADING
+IF (${ESCARGOT_OUTPUT} STREQUAL "shared_lib")
+    SET (GC_LIBTYPE shared)
+ELSE()
+    SET (GC_LIBTYPE static)
+ENDIF()
+
+SET (GC_CFLAGS_COMMON "-g3 -fdata-sections -ffunction-sections -DHAVE_CONFIG_H -DESCARGOT -DIGNORE_DYNAMIC_LOADING -DGC_DONT_REGISTER_MAIN_STATIC_DATA -Wno-unused-variable")
 
-    IF (${ESCARGOT_ARCH} STREQUAL "x86")
-        SET (GC_CFLAGS_ARCH "-m32")
-        SET (GC_LDFLAGS_ARCH "-m32")
-    ELSEIF (${ESCARGOT_ARCH} STREQUAL "arm")
-        SET (GC_CFLAGS_ARCH "-march=armv7-a -mthumb -finline-limit=64")
-    ENDIF()
+IF (${ESCARGOT_ARCH} STREQUAL "x86")
+    SET (GC_CFLAGS_ARCH "-m32")
+    SET (GC_LDFLAGS_ARCH "-m32")
+ELSEIF (${ESCARGOT_ARCH} STREQUAL "arm")
+    SET (GC_CFLAGS_ARCH "-march=armv7-a -mthumb -finline-limit=64")
+ENDIF()
+
+IF (${ESCARGOT_MODE} STREQUAL "debug")
+    SET (GC_CFLAGS_MODE "-O0 -DGC_DEBUG")
+ELSE()
+    SET (GC_CFLAGS_MODE "-O2")
+ENDIF()
 
-    IF (${ESCARGOT_MODE} STREQUAL "debug")
-        SET (GC_CFLAGS_MODE "-O0 -DGC_DEBUG")
-    ELSE()
-        SET (GC_CFLAGS_MODE "-O2")
-    ENDIF()
+IF (${GC_LIBTYPE} STREQUAL "shared")
+    SET (GC_CFLAGS_LIBTYPE "-fPIC")
+ENDIF()
 
-    SET (GC_CFLAGS "${GC_CFLAGS_COMMON} ${GC_CFLAGS_ARCH} ${GC_CFLAGS_MODE} $ENV{CFLAGS}")
-    SET (GC_LDFLAGS "${GC_LDFLAGS_ARCH} ${GC_CFLAGS}")
+SET (GC_CFLAGS "${GC_CFLAGS_COMMON} ${GC_CFLAGS_ARCH} ${GC_CFLAGS_MODE} ${GC_CFLAGS_LIBTYPE} $ENV{CFLAGS}")
+SET (GC_LDFLAGS "${GC_LDFLAGS_ARCH} ${GC_CFLAGS}")
 
+IF (${ESCARGOT_THREADING})
+    SET (GC_CONFFLAGS_COMMON --enable-munmap --disable-parallel-mark --enable-large-config --enable-threads=posix)
+ELSE()
     SET (GC_CONFFLAGS_COMMON --enable-munmap --disable-parallel-mark --enable-large-config --disable-pthread --disable-threads)
-    IF (${ESCARGOT_MODE} STREQUAL "debug")
-        SET (GC_CONFFLAGS_MODE --enable-debug --enable-gc-debug)
-    ELSE()
-        SET (GC_CONFFLAGS_MODE --disable-debug --disable-gc-debug)
-    ENDIF()
-    SET (GC_CONFFLAGS
-        ${GC_CONFFLAGS_COMMON}
-        ${GC_CONFFLAGS_MODE}
-    )
-
-    SET (GC_BUILDDIR ${GCUTIL_ROOT}/bdwgc/out/${ESCARGOT_HOST}/${ESCARGOT_ARCH}/${ESCARGOT_MODE}.static)
-    SET (GC_TARGET ${GC_BUILDDIR}/.libs/libgc.a)
-
-    ADD_CUSTOM_COMMAND (OUTPUT ${GC_TARGET}
-            COMMENT "BUILD GC"
-            WORKING_DIRECTORY ${GCUTIL_ROOT}/bdwgc
-            COMMAND autoreconf -vif
-            COMMAND automake --add-missing
-            COMMAND ${CMAKE_COMMAND} -E make_directory ${GC_BUILDDIR}
-            COMMAND cd ${GC_BUILDDIR} && ../../../../configure ${GC_CONFFLAGS} CFLAGS=${GC_CFLAGS} LDFLAGS=${GC_LDFLAGS}
-            COMMAND cd ${GC_BUILDDIR} && make -j
-    )
-
-    ADD_CUSTOM_TARGET (gc
-            DEPENDS ${GC_TARGET}
-            COMMAND echo "GC TARGET"
-    )
 ENDIF()
+IF (${ESCARGOT_MODE} STREQUAL "debug")
+    SET (GC_CONFFLAGS_MODE --enable-debug --enable-gc-debug)
+ELSE()
+    SET (GC_CONFFLAGS_MODE --disable-debug --disable-gc-debug)
+ENDIF()
+SET (GC_CONFFLAGS
+    ${GC_CONFFLAGS_COMMON}
+    ${GC_CONFFLAGS_MODE}
+)
+
+SET (GC_BUILDDIR ${GCUTIL_ROOT}/bdwgc/out/${ESCARGOT_HOST}/${ESCARGOT_ARCH}/${ESCARGOT_MODE}.${GC_LIBTYPE})
+SET (GC_TARGET ${GC_BUILDDIR}/.libs/libgc.a)
+
+ADD_CUSTOM_COMMAND (OUTPUT ${GC_TARGET}
+        COMMENT "BUILD GC"
+        WORKING_DIRECTORY ${GCUTIL_ROOT}/bdwgc
+        COMMAND autoreconf -vif
+        COMMAND automake --add-missing
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${GC_BUILDDIR}
+        COMMAND cd ${GC_BUILDDIR} && ../../../../configure ${GC_CONFFLAGS} CFLAGS=${GC_CFLAGS} LDFLAGS=${GC_LDFLAGS}
+        COMMAND cd ${GC_BUILDDIR} && make -j
+)
+
+ADD_CUSTOM_TARGET (gc
+        DEPENDS ${GC_TARGET}
+        COMMAND echo "GC TARGET"
+)
 
 
 # BUILD
@@ -186,6 +204,7 @@ IF (${ESCARGOT_OUTPUT} STREQUAL "bin")
 
 ELSEIF (${ESCARGOT_OUTPUT} STREQUAL "shared_lib")
     ADD_LIBRARY (${ESCARGOT_TARGET} SHARED ${ESCARGOT_SRC_LIST})
+    ADD_DEPENDENCIES (${ESCARGOT_TARGET} gc)
 
     TARGET_LINK_LIBRARIES (${ESCARGOT_TARGET} ${ESCARGOT_LIBRARIES} ${ESCARGOT_LDFLAGS})
     TARGET_INCLUDE_DIRECTORIES (${ESCARGOT_TARGET} PUBLIC ${ESCARGOT_INCDIRS})
@@ -194,6 +213,7 @@ ELSEIF (${ESCARGOT_OUTPUT} STREQUAL "shared_lib")
 
 ELSEIF (${ESCARGOT_OUTPUT} STREQUAL "static_lib")
     ADD_LIBRARY (${ESCARGOT_TARGET} STATIC ${ESCARGOT_SRC_LIST})
+    ADD_DEPENDENCIES (${ESCARGOT_TARGET} gc)
 
     TARGET_LINK_LIBRARIES (${ESCARGOT_TARGET} ${ESCARGOT_LIBRARIES} ${ESCARGOT_LDFLAGS})
     TARGET_INCLUDE_DIRECTORIES (${ESCARGOT_TARGET} PUBLIC ${ESCARGOT_INCDIRS})
@@ -39,7 +39,10 @@ CFLAGS_FROM_ENV=$(echo $CFLAGS)
 CXXFLAGS_FROM_ENV=$(echo $CXXFLAGS)
 
 GCCONFFLAGS_COMMON=" --enable-munmap --disable-parallel-mark --enable-large-config " # --enable-large-config --enable-cplusplus"
-if [[ $PORT == PANDO_EFL ]]; then
+# THREADING=1 should match `make THREADING=1`, which runs one VMInstance per thread
+if [[ $THREADING == 1 ]]; then
+    GCCONFFLAGS_COMMON+=" --enable-threads=posix "
+elif [[ $PORT == PANDO_EFL ]]; then
     GCCONFFLAGS_COMMON+=" --disable-pthread --disable-threads "
 fi
 CFLAGS_COMMON=" -g3 "
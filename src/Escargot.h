@@ -142,6 +142,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <climits>
 #include <clocale>
@@ -157,6 +158,7 @@
 #include <locale>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
@@ -324,6 +326,17 @@ typedef uint16_t ByteCodeRegisterIndex;
 #define STRING_SUB_STRING_MIN_VIEW_LENGTH 32
 #endif
 
+// substring of a string longer than STRING_VIEW_LARGE_PARENT_LENGTH is copied instead of
+// being a view when it is shorter than 1/STRING_VIEW_MIN_PARENT_FRACTION of the string,
+// so a few small fields don't keep a huge string alive
+#ifndef STRING_VIEW_LARGE_PARENT_LENGTH
+#define STRING_VIEW_LARGE_PARENT_LENGTH (1024 * 64)
+#endif
+
+#ifndef STRING_VIEW_MIN_PARENT_FRACTION
+#define STRING_VIEW_MIN_PARENT_FRACTION 8
+#endif
+
 #ifndef STRING_BUILDER_INLINE_STORAGE_MAX
 #define STRING_BUILDER_INLINE_STORAGE_MAX 24
 #endif
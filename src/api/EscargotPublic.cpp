@@ -38,6 +38,9 @@
 #include "runtime/ErrorObject.h"
 #include "runtime/DateObject.h"
 #include "runtime/StringObject.h"
+#include "runtime/ExternalString.h"
+#include "runtime/ObjectTemplate.h"
+#include "runtime/PropertyNameList.h"
 #include "runtime/NumberObject.h"
 #include "runtime/BooleanObject.h"
 #include "runtime/RegExpObject.h"
@@ -71,6 +74,8 @@ DEFINE_CAST(String);
 DEFINE_CAST(Symbol);
 DEFINE_CAST(PointerValue);
 DEFINE_CAST(Object);
+DEFINE_CAST(ObjectTemplate);
+DEFINE_CAST(PropertyNameList);
 DEFINE_CAST(IteratorObject);
 DEFINE_CAST(ArrayObject)
 DEFINE_CAST(StringObject)
@@ -94,6 +99,7 @@ DEFINE_CAST(Job);
 #endif
 DEFINE_CAST(Script);
 DEFINE_CAST(ScriptParser);
+DEFINE_CAST(BackgroundParseTask);
 
 #if ESCARGOT_ENABLE_TYPEDARRAY
 DEFINE_CAST(ArrayBufferObject);
@@ -142,9 +148,9 @@ inline AtomicString toImpl(AtomicStringRef* v)
     return AtomicString::fromPayload(reinterpret_cast<void*>(v));
 }
 
-void Globals::initialize(bool applyMallOpt, bool applyGcOpt)
+void Globals::initialize(bool applyMallOpt, bool applyGcOpt, bool enableIncrementalGC)
 {
-    Heap::initialize(applyMallOpt, applyGcOpt);
+    Heap::initialize(applyMallOpt, applyGcOpt, enableIncrementalGC);
 }
 
 void Globals::finalize()
@@ -152,6 +158,16 @@ void Globals::finalize()
     return;
 }
 
+void Globals::registerCurrentThread()
+{
+    Heap::registerCurrentThread();
+}
+
+void Globals::unregisterCurrentThread()
+{
+    Heap::unregisterCurrentThread();
+}
+
 StringRef* StringRef::fromASCII(const char* s)
 {
     return toRef(new ASCIIString(s, strlen(s)));
@@ -172,6 +188,16 @@ StringRef* StringRef::fromUTF16(const char16_t* s, size_t len)
     return toRef(new UTF16String(s, len));
 }
 
+StringRef* StringRef::createExternal(const char* latin1, size_t len, ExternalStringReleaseCallback releaseCallback, void* callbackData)
+{
+    return toRef(new ExternalString((const LChar*)latin1, len, releaseCallback, callbackData));
+}
+
+StringRef* StringRef::createExternal(const char16_t* s, size_t len, ExternalStringReleaseCallback releaseCallback, void* callbackData)
+{
+    return toRef(new ExternalString(s, len, releaseCallback, callbackData));
+}
+
 StringRef* StringRef::emptyString()
 {
     return toRef(String::emptyString);
@@ -465,6 +491,63 @@ SymbolRef* VMInstanceRef::unscopablesSymbol()
     return toRef(toImpl(this)->globalSymbols().unscopables);
 }
 
+VMInstanceRef::GCPauseTimeHistogram VMInstanceRef::gcPauseTimeHistogram()
+{
+    static_assert((size_t)GCPauseTimeHistogram::BucketCount == (size_t)Heap::GCPauseTimeHistogram::BucketCount, "");
+
+    Heap::GCPauseTimeHistogram histogram = Heap::gcPauseTimeHistogram();
+    GCPauseTimeHistogram result;
+    for (size_t i = 0; i < GCPauseTimeHistogram::BucketCount; i++) {
+        result.m_buckets[i] = histogram.m_buckets[i];
+    }
+    result.m_pauseCount = histogram.m_pauseCount;
+    result.m_totalPauseTime = histogram.m_totalPauseTime;
+    result.m_maxPauseTime = histogram.m_maxPauseTime;
+    result.m_lastPauseTime = histogram.m_lastPauseTime;
+    return result;
+}
+
+void VMInstanceRef::resetGCPauseTimeHistogram()
+{
+    Heap::resetGCPauseTimeHistogram();
+}
+
+VMInstanceRef::GCHeapStatistics VMInstanceRef::gcHeapStatistics()
+{
+    const Heap::ObjectAllocationCounts& counts = Heap::objectAllocationCounts();
+    GCHeapStatistics result;
+    result.m_heapSize = GC_get_heap_size();
+    result.m_freeBytes = GC_get_free_bytes();
+    result.m_bytesAllocatedSinceLastGC = GC_get_bytes_since_gc();
+    result.m_gcCount = GC_get_gc_no();
+    result.m_objectStructureCount = counts.m_objectStructureCount.value();
+    result.m_stringCount = counts.m_stringCount.value();
+    result.m_byteCodeBlockCount = counts.m_byteCodeBlockCount.value();
+    result.m_liveByteCodeBlockCount = counts.m_liveByteCodeBlockCount.value();
+    return result;
+}
+
+VMInstanceRef::LiveHeapObjectStatistics VMInstanceRef::computeLiveHeapObjectStatistics()
+{
+    static_assert((size_t)LiveHeapObjectStatistics::OtherKind == (size_t)HeapObjectKind::NumberOfKind, "");
+    static_assert((size_t)LiveHeapObjectStatistics::InterpretedCodeBlockKind == (size_t)HeapObjectKind::InterpretedCodeBlockKind, "");
+
+    LiveHeapObjectStatistics result;
+    Escargot::computeLiveHeapObjectStatistics(result.m_bytes, result.m_counts);
+    return result;
+}
+
+bool VMInstanceRef::startSamplingProfiler(size_t intervalInMicroseconds)
+{
+    return toImpl(this)->startSamplingProfiler(intervalInMicroseconds);
+}
+
+StringRef* VMInstanceRef::stopSamplingProfiler()
+{
+    std::string result = toImpl(this)->stopSamplingProfiler();
+    return toRef(String::fromUTF8(result.data(), result.length()));
+}
+
 #ifdef ESCARGOT_ENABLE_PROMISE
 ValueRef* VMInstanceRef::drainJobQueue()
 {
@@ -472,6 +555,31 @@ ValueRef* VMInstanceRef::drainJobQueue()
     return toRef(imp->drainJobQueue());
 }
 
+ValueRef* VMInstanceRef::drainJobQueue(size_t maxJobCount, double maxTimeInMilliseconds)
+{
+    VMInstance* imp = toImpl(this);
+    uint64_t maxTime = maxTimeInMilliseconds > 0 ? std::max((uint64_t)(maxTimeInMilliseconds * 1000), (uint64_t)1) : 0;
+    return toRef(imp->drainJobQueue(maxJobCount, maxTime));
+}
+
+size_t VMInstanceRef::pendingJobCount()
+{
+    return toImpl(this)->pendingJobCount();
+}
+
+void VMInstanceRef::setPendingJobListener(PendingJobListener l, void* data)
+{
+    VMInstance* imp = toImpl(this);
+    if (!l) {
+        imp->setPendingJobListener(nullptr, nullptr);
+        return;
+    }
+    imp->m_publicPendingJobListenerPointer = (void*)l;
+    imp->setPendingJobListener([](VMInstance* instance, void* data) {
+        ((PendingJobListener)instance->m_publicPendingJobListenerPointer)(toRef(instance), data);
+    }, data);
+}
+
 void VMInstanceRef::setNewPromiseJobListener(NewPromiseJobListener l)
 {
     VMInstance* imp = toImpl(this);
@@ -493,16 +601,7 @@ void ContextRef::clearRelatedQueuedPromiseJobs()
 {
     Context* imp = toImpl(this);
 #ifdef ESCARGOT_ENABLE_PROMISE
-    DefaultJobQueue* jobQueue = DefaultJobQueue::get(imp->vmInstance()->jobQueue());
-    std::list<Job*, gc_allocator<Job*>>& impl = jobQueue->impl();
-    auto iter = impl.begin();
-    while (iter != impl.end()) {
-        if ((*iter)->relatedContext() == imp) {
-            iter = impl.erase(iter);
-        } else {
-            iter++;
-        }
-    }
+    DefaultJobQueue::get(imp->vmInstance()->jobQueue())->removeJobsOf(imp);
 #endif
 }
 
@@ -753,8 +852,9 @@ bool ObjectRef::defineAccessorProperty(ExecutionStateRef* state, ValueRef* prope
                                            ObjectPropertyName(*toImpl(state), toImpl(propertyName)), ObjectPropertyDescriptor(JSGetterSetter(toImpl(desc.m_getter), toImpl(desc.m_setter)), (ObjectPropertyDescriptor::PresentAttribute)desc.m_attribute));
 }
 
-bool ObjectRef::defineNativeDataAccessorProperty(ExecutionStateRef* state, ValueRef* propertyName, NativeDataAccessorPropertyData* publicData)
+static ObjectPropertyNativeGetterSetterData* toNativeGetterSetterData(ObjectRef::NativeDataAccessorPropertyData* publicData)
 {
+    typedef ObjectRef::NativeDataAccessorPropertyData NativeDataAccessorPropertyData;
     ObjectPropertyNativeGetterSetterData* innerData = new ObjectPropertyNativeGetterSetterData(publicData->m_isWritable, publicData->m_isEnumerable, publicData->m_isConfigurable, [](ExecutionState& state, Object* self, const SmallValue& privateDataFromObjectPrivateArea) -> Value {
         NativeDataAccessorPropertyData* publicData = reinterpret_cast<NativeDataAccessorPropertyData*>(privateDataFromObjectPrivateArea.payload());
         return toImpl(publicData->m_getter(toRef(&state), toRef(self), publicData));
@@ -775,7 +875,12 @@ bool ObjectRef::defineNativeDataAccessorProperty(ExecutionStateRef* state, Value
         };
     }
 
-    return toImpl(this)->defineNativeDataAccessorProperty(*toImpl(state), ObjectPropertyName(*toImpl(state), toImpl(propertyName)), innerData, Value(Value::FromPayload, (intptr_t)publicData));
+    return innerData;
+}
+
+bool ObjectRef::defineNativeDataAccessorProperty(ExecutionStateRef* state, ValueRef* propertyName, NativeDataAccessorPropertyData* publicData)
+{
+    return toImpl(this)->defineNativeDataAccessorProperty(*toImpl(state), ObjectPropertyName(*toImpl(state), toImpl(propertyName)), toNativeGetterSetterData(publicData), Value(Value::FromPayload, (intptr_t)publicData));
 }
 
 bool ObjectRef::set(ExecutionStateRef* state, ValueRef* propertyName, ValueRef* value)
@@ -845,6 +950,42 @@ void ObjectRef::removeFromHiddenClassChain(ExecutionStateRef* state)
     toImpl(this)->markThisObjectDontNeedStructureTransitionTable(*toImpl(state));
 }
 
+ObjectTemplateRef* ObjectTemplateRef::create()
+{
+    return toRef(new ObjectTemplate());
+}
+
+void ObjectTemplateRef::setDataProperty(StringRef* propertyName, ValueRef* value, bool isWritable, bool isEnumerable, bool isConfigurable)
+{
+    int attr = 0;
+    if (isWritable)
+        attr = attr | ObjectPropertyDescriptor::WritablePresent;
+    else
+        attr = attr | ObjectPropertyDescriptor::NonWritablePresent;
+
+    if (isEnumerable)
+        attr = attr | ObjectPropertyDescriptor::EnumerablePresent;
+    else
+        attr = attr | ObjectPropertyDescriptor::NonEnumerablePresent;
+
+    if (isConfigurable)
+        attr = attr | ObjectPropertyDescriptor::ConfigurablePresent;
+    else
+        attr = attr | ObjectPropertyDescriptor::NonConfigurablePresent;
+
+    toImpl(this)->addDataProperty(toImpl(propertyName), toImpl(value), (ObjectPropertyDescriptor::PresentAttribute)attr);
+}
+
+void ObjectTemplateRef::setNativeDataAccessorProperty(StringRef* propertyName, ObjectRef::NativeDataAccessorPropertyData* data)
+{
+    toImpl(this)->addNativeDataAccessorProperty(toImpl(propertyName), toNativeGetterSetterData(data), Value(Value::FromPayload, (intptr_t)data));
+}
+
+ObjectRef* ObjectTemplateRef::instantiate(ExecutionStateRef* state)
+{
+    return toRef(toImpl(this)->instantiate(*toImpl(state)));
+}
+
 void ObjectRef::enumerateObjectOwnProperies(ExecutionStateRef* state, const std::function<bool(ExecutionStateRef* state, ValueRef* propertyName, bool isWritable, bool isEnumerable, bool isConfigurable)>& cb)
 {
     toImpl(this)->enumeration(*toImpl(state), [](ExecutionState& state, Object* self, const ObjectPropertyName& name, const ObjectStructurePropertyDescriptor& desc, void* data) -> bool {
@@ -855,6 +996,52 @@ void ObjectRef::enumerateObjectOwnProperies(ExecutionStateRef* state, const std:
                               (void*)&cb);
 }
 
+void ObjectRef::getProperties(ExecutionStateRef* state, PropertyNameListRef* names, ValueRef** values)
+{
+    PropertyNameList* list = toImpl(names);
+    Value* result = ALLOCA(sizeof(Value) * list->size(), Value, state);
+    list->get(*toImpl(state), toImpl(this), result);
+    for (size_t i = 0; i < list->size(); i++) {
+        values[i] = toRef(result[i]);
+    }
+}
+
+bool ObjectRef::setProperties(ExecutionStateRef* state, PropertyNameListRef* names, ValueRef** values)
+{
+    PropertyNameList* list = toImpl(names);
+    Value* newValues = ALLOCA(sizeof(Value) * list->size(), Value, state);
+    for (size_t i = 0; i < list->size(); i++) {
+        newValues[i] = toImpl(values[i]);
+    }
+    return list->set(*toImpl(state), toImpl(this), newValues);
+}
+
+size_t ObjectRef::getOwnEnumerableDataProperties(ExecutionStateRef* state, ValueRef** keys, ValueRef** values, size_t bufferSize)
+{
+    Value* resultKeys = ALLOCA(sizeof(Value) * bufferSize, Value, state);
+    Value* resultValues = ALLOCA(sizeof(Value) * bufferSize, Value, state);
+    size_t count = PropertyNameList::getOwnEnumerableDataProperties(*toImpl(state), toImpl(this), resultKeys, resultValues, bufferSize);
+    for (size_t i = 0; i < std::min(count, bufferSize); i++) {
+        keys[i] = toRef(resultKeys[i]);
+        values[i] = toRef(resultValues[i]);
+    }
+    return count;
+}
+
+PropertyNameListRef* PropertyNameListRef::create(AtomicStringRef** names, size_t count)
+{
+    AtomicString* list = ALLOCA(sizeof(AtomicString) * count, AtomicString, nullptr);
+    for (size_t i = 0; i < count; i++) {
+        new (&list[i]) AtomicString(toImpl(names[i]));
+    }
+    return toRef(new PropertyNameList(list, count));
+}
+
+size_t PropertyNameListRef::size()
+{
+    return toImpl(this)->size();
+}
+
 FunctionObjectRef* GlobalObjectRef::object()
 {
     return toRef(toImpl(this)->object());
@@ -1379,6 +1566,11 @@ void ContextRef::setSecurityPolicyCheckCallback(SecurityPolicyCheckCallback cb)
     });
 }
 
+void ContextRef::setRandomSeed(uint64_t seed)
+{
+    toImpl(this)->randomGenerator().seed(seed);
+}
+
 ExecutionStateRef* ExecutionStateRef::create(ContextRef* ctxref)
 {
     Context* ctx = toImpl(ctxref);
@@ -1700,6 +1892,20 @@ IteratorObjectRef* ArrayObjectRef::entries(ExecutionStateRef* state)
     return toRef(toImpl(this)->entries(*toImpl(state)));
 }
 
+void ArrayObjectRef::setElements(ExecutionStateRef* state, size_t start, ValueRef** values, size_t count)
+{
+    toImpl(this)->setElements(*toImpl(state), start, count, [values](size_t i) -> Value {
+        return toImpl(values[i]);
+    });
+}
+
+void ArrayObjectRef::setElements(ExecutionStateRef* state, size_t start, const double* values, size_t count)
+{
+    toImpl(this)->setElements(*toImpl(state), start, count, [values](size_t i) -> Value {
+        return Value(values[i]);
+    });
+}
+
 COMPILE_ASSERT((int)ErrorObject::Code::None == (int)ErrorObjectRef::Code::None, "");
 COMPILE_ASSERT((int)ErrorObject::Code::ReferenceError == (int)ErrorObjectRef::Code::ReferenceError, "");
 COMPILE_ASSERT((int)ErrorObject::Code::TypeError == (int)ErrorObjectRef::Code::TypeError, "");
@@ -1936,6 +2142,27 @@ ScriptParserRef::ScriptParserResult ScriptParserRef::parse(StringRef* script, St
     return ScriptParserRef::ScriptParserResult(toRef(result.m_script), StringRef::emptyString());
 }
 
+BackgroundParseTaskRef* ScriptParserRef::createBackgroundParseTask(StringRef* script, StringRef* fileName)
+{
+    return toRef(toImpl(this)->createBackgroundParseTask(toImpl(script), toImpl(fileName)));
+}
+
+void BackgroundParseTaskRef::run()
+{
+    toImpl(this)->run();
+}
+
+ScriptParserRef::ScriptParserResult BackgroundParseTaskRef::finalize()
+{
+    BackgroundParseTask* task = toImpl(this);
+    auto result = task->finalize();
+    delete task;
+    if (result.m_error) {
+        return ScriptParserRef::ScriptParserResult(nullptr, toRef(result.m_error->message));
+    }
+    return ScriptParserRef::ScriptParserResult(toRef(result.m_script), StringRef::emptyString());
+}
+
 ValueRef* ScriptRef::execute(ExecutionStateRef* state)
 {
     return toRef(toImpl(this)->execute(*toImpl(state)));
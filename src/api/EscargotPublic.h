@@ -44,6 +44,8 @@ class SymbolRef;
 class ValueRef;
 class PointerValueRef;
 class ObjectRef;
+class ObjectTemplateRef;
+class PropertyNameListRef;
 class GlobalObjectRef;
 class FunctionObjectRef;
 class ArrayObjectRef;
@@ -68,14 +70,26 @@ class BooleanObjectRef;
 class RegExpObjectRef;
 class ScriptRef;
 class ScriptParserRef;
+class BackgroundParseTaskRef;
 class ExecutionStateRef;
 class ValueVectorRef;
 class JobRef;
 
+// threading model (needs ESCARGOT_THREADING build option)
+// VMInstanceRef and everything created from it (ContextRef, values, ...) belongs to one thread.
+// several threads can run their own VMInstanceRef at the same time, but they should not share any value.
+// Globals::initialize should be called once before creating threads,
+// and other threads should call registerCurrentThread before using Escargot
+// and unregisterCurrentThread after destroying their VMInstanceRef
 class EXPORT Globals {
 public:
-    static void initialize(bool applyMallOpt = false, bool applyGcOpt = false);
+    // enableIncrementalGC makes GC work in small steps between allocations instead of
+    // marking whole heap at once. it should be decided before any VMInstance is created
+    static void initialize(bool applyMallOpt = false, bool applyGcOpt = false, bool enableIncrementalGC = false);
     static void finalize();
+
+    static void registerCurrentThread();
+    static void unregisterCurrentThread();
 };
 
 // `double` value is not presented in PointerValue, but it is stored in heap
@@ -145,6 +159,16 @@ public:
     static StringRef* fromUTF16(const char16_t* s, size_t len);
     static StringRef* emptyString();
 
+    // create a string which refers the given buffer without copying it.
+    // 8-bit buffer should be Latin1 (ASCII is ok, but UTF-8 is not).
+    // buffer should not be changed and should be alive until releaseCallback is called.
+    // releaseCallback is called when the string is collected by GC, so it can free or munmap the buffer.
+    // it can be nullptr if the buffer lives longer than every VMInstance.
+    // the string can be used as source of ScriptParserRef::parse, so an mmap'd source file doesn't need a copy
+    typedef void (*ExternalStringReleaseCallback)(const void* buffer, size_t length, void* callbackData);
+    static StringRef* createExternal(const char* latin1, size_t len, ExternalStringReleaseCallback releaseCallback = nullptr, void* callbackData = nullptr);
+    static StringRef* createExternal(const char16_t* s, size_t len, ExternalStringReleaseCallback releaseCallback = nullptr, void* callbackData = nullptr);
+
     char16_t charAt(size_t idx);
     size_t length();
     bool equals(StringRef* src);
@@ -205,13 +229,81 @@ public:
     SymbolRef* iteratorSymbol();
     SymbolRef* unscopablesSymbol();
 
+    // GC heap is shared by every VMInstance, so this histogram is process-wide
+    // times are in microseconds. m_buckets[0] counts pauses shorter than 1ms,
+    // m_buckets[n] counts pauses in [2^(n-1), 2^n) ms and the last bucket counts every longer pause.
+    // with incremental GC (see Globals::initialize), a pause is the stop-the-world phase which finishes
+    // each collection cycle. marking steps done inside allocations before it are not counted,
+    // so the histogram shows how long the world is stopped, not every delay an allocation can see
+    struct GCPauseTimeHistogram {
+        enum { BucketCount = 12 };
+        size_t m_buckets[BucketCount];
+        size_t m_pauseCount;
+        uint64_t m_totalPauseTime;
+        uint64_t m_maxPauseTime;
+        uint64_t m_lastPauseTime;
+    };
+
+    GCPauseTimeHistogram gcPauseTimeHistogram();
+    void resetGCPauseTimeHistogram();
+
+    // these values are cheap to read, so they can be polled periodically
+    // object counts are cumulative numbers of allocations except m_liveByteCodeBlockCount.
+    // GC heap and the counters are shared by every VMInstance, so these are process-wide too
+    // and include objects of VMInstances running on other threads
+    struct GCHeapStatistics {
+        size_t m_heapSize;
+        size_t m_freeBytes;
+        size_t m_bytesAllocatedSinceLastGC;
+        size_t m_gcCount;
+        size_t m_objectStructureCount;
+        size_t m_stringCount;
+        size_t m_byteCodeBlockCount;
+        size_t m_liveByteCodeBlockCount;
+    };
+
+    GCHeapStatistics gcHeapStatistics();
+
+    // live bytes and object counts for each heap object kind
+    // this runs a full GC to get precise mark status, so don't call it frequently
+    struct LiveHeapObjectStatistics {
+        enum Kind {
+            ValueVectorKind = 0,
+            ArrayObjectKind,
+            CodeBlockKind,
+            InterpretedCodeBlockKind,
+            OtherKind,
+            KindCount,
+        };
+        size_t m_bytes[KindCount];
+        size_t m_counts[KindCount];
+    };
+
+    LiveHeapObjectStatistics computeLiveHeapObjectStatistics();
+
+    // sampling profiler uses process-wide timer signal (SIGPROF), so only one VMInstanceRef can be profiled at a time
+    // returns false if another VMInstanceRef is being profiled or the platform is not supported
+    bool startSamplingProfiler(size_t intervalInMicroseconds = 1000);
+    // returns samples in collapsed stack format of flamegraph.pl ("outer;inner;leaf count" per line)
+    // innermost frame has line of sampled code, and outer frames have line of function start
+    StringRef* stopSamplingProfiler();
+
 #ifdef ESCARGOT_ENABLE_PROMISE
     // if there is an error, executing will be stopped and returns ErrorValue
     // if thres is no job or no error, returns EmptyValue
     ValueRef* drainJobQueue();
+    // runs at most maxJobCount jobs, and stops when maxTimeInMilliseconds is passed (0 means no time limit)
+    // so event loop can do other works between jobs. pendingJobCount tells whether it should be called again
+    ValueRef* drainJobQueue(size_t maxJobCount, double maxTimeInMilliseconds = 0);
+    size_t pendingJobCount();
 
     typedef void (*NewPromiseJobListener)(ExecutionStateRef* state, JobRef* job);
     void setNewPromiseJobListener(NewPromiseJobListener l);
+
+    // called when a job is added into empty job queue (it is not called with NewPromiseJobListener)
+    // embedder can schedule drainJobQueue on its event loop from here
+    typedef void (*PendingJobListener)(VMInstanceRef* vm, void* data);
+    void setPendingJobListener(PendingJobListener l, void* data = nullptr);
 #endif
 };
 
@@ -235,6 +327,9 @@ public:
     VirtualIdentifierCallback virtualIdentifierCallback();
 
     void setSecurityPolicyCheckCallback(SecurityPolicyCheckCallback cb);
+
+    // makes Math.random of this context return the same sequence for the same seed
+    void setRandomSeed(uint64_t seed);
 };
 
 class EXPORT AtomicStringRef {
@@ -493,6 +588,15 @@ public:
 
     void enumerateObjectOwnProperies(ExecutionStateRef* state, const std::function<bool(ExecutionStateRef* state, ValueRef* propertyName, bool isWritable, bool isEnumerable, bool isConfigurable)>& cb);
 
+    // reads or writes properties of names in list at once. values should have names->size() elements
+    // setProperties returns false if any of properties could not be set
+    void getProperties(ExecutionStateRef* state, PropertyNameListRef* names, ValueRef** values);
+    bool setProperties(ExecutionStateRef* state, PropertyNameListRef* names, ValueRef** values);
+
+    // fills own enumerable data properties (except symbol keys) into keys and values up to bufferSize
+    // returns number of all those properties, so embedder can retry with bigger buffer if result > bufferSize
+    size_t getOwnEnumerableDataProperties(ExecutionStateRef* state, ValueRef** keys, ValueRef** values, size_t bufferSize);
+
     bool isExtensible(ExecutionStateRef* state);
     void preventExtensions(ExecutionStateRef* state);
 
@@ -502,6 +606,29 @@ public:
     void removeFromHiddenClassChain(ExecutionStateRef* state);
 };
 
+// ObjectTemplateRef computes structure and values of its objects once for each Context,
+// so instantiate() only copies them without walking structure transitions.
+// ObjectTemplateRef is allocated in GC heap. embedder should keep it where GC can see (eg. VMInstanceRef::addRoot)
+class EXPORT ObjectTemplateRef {
+public:
+    static ObjectTemplateRef* create();
+
+    void setDataProperty(StringRef* propertyName, ValueRef* value, bool isWritable, bool isEnumerable, bool isConfigurable);
+    // data must be allocated in gc-heap like ObjectRef::defineNativeDataAccessorProperty
+    void setNativeDataAccessorProperty(StringRef* propertyName, ObjectRef::NativeDataAccessorPropertyData* data);
+
+    ObjectRef* instantiate(ExecutionStateRef* state);
+};
+
+// PropertyNameListRef keeps slot index of each name for the last object structure it accessed,
+// so accessing many objects of same shape with ObjectRef::getProperties/setProperties skips property lookup.
+// PropertyNameListRef is allocated in GC heap. embedder should keep it where GC can see (eg. VMInstanceRef::addRoot)
+class EXPORT PropertyNameListRef {
+public:
+    static PropertyNameListRef* create(AtomicStringRef** names, size_t count);
+    size_t size();
+};
+
 class EXPORT GlobalObjectRef : public ObjectRef {
 public:
     FunctionObjectRef* object();
@@ -623,6 +750,10 @@ public:
     IteratorObjectRef* values(ExecutionStateRef* state);
     IteratorObjectRef* keys(ExecutionStateRef* state);
     IteratorObjectRef* entries(ExecutionStateRef* state);
+
+    // defines elements [start, start + count) at once. length of array grows if needed
+    void setElements(ExecutionStateRef* state, size_t start, ValueRef** values, size_t count);
+    void setElements(ExecutionStateRef* state, size_t start, const double* values, size_t count);
 };
 
 class EXPORT ErrorObjectRef : public ObjectRef {
@@ -865,6 +996,20 @@ public:
     };
 
     ScriptParserResult parse(StringRef* script, StringRef* fileName);
+
+    // parses in steps, so several scripts can be parsed on worker threads at the same time (needs ESCARGOT_THREADING)
+    // 1. createBackgroundParseTask on the thread owns VMInstanceRef
+    // 2. BackgroundParseTaskRef::run on a worker thread which called Globals::registerCurrentThread
+    // 3. BackgroundParseTaskRef::finalize on the owning thread after run returned. it destroys the task
+    // while any task of a VMInstanceRef is alive, interning names of the VMInstanceRef takes a lock
+    BackgroundParseTaskRef* createBackgroundParseTask(StringRef* script, StringRef* fileName);
+};
+
+class EXPORT BackgroundParseTaskRef {
+public:
+    void run();
+    // if run is not called yet, finalize parses on the owning thread
+    ScriptParserRef::ScriptParserResult finalize();
 };
 
 class EXPORT ScriptRef {
@@ -184,7 +184,7 @@ void iterateSpecificKindOfObject(ExecutionState& state, HeapObjectKind kind, Hea
     ASSERT(!GC_is_disabled());
     GC_gcollect(); // Update mark status. See comments of iterateSpecificKindOfObject in src/heap/Allocator.h
     GC_disable();
-    GC_enumerate_reachable_objects_inner([](void* obj, size_t bytes, void* cd) {
+    GC_enumerate_reachable_objects_inner([](void* obj, size_t objBytes, void* cd) {
         size_t size;
         int kind = GC_get_kind_and_size(obj, &size);
         ASSERT(size == bytes);
@@ -198,6 +198,39 @@ void iterateSpecificKindOfObject(ExecutionState& state, HeapObjectKind kind, Hea
     GC_enable();
 }
 
+void computeLiveHeapObjectStatistics(size_t* bytes, size_t* counts)
+{
+    struct LiveHeapObjectStatisticsData {
+        size_t* bytes;
+        size_t* counts;
+    };
+
+    LiveHeapObjectStatisticsData data{ bytes, counts };
+    memset(bytes, 0, sizeof(size_t) * (HeapObjectKind::NumberOfKind + 1));
+    memset(counts, 0, sizeof(size_t) * (HeapObjectKind::NumberOfKind + 1));
+
+    ASSERT(!GC_is_disabled());
+    GC_gcollect(); // Update mark status. See comments of iterateSpecificKindOfObject in src/heap/Allocator.h
+    GC_disable();
+    GC_enumerate_reachable_objects_inner([](void* obj, size_t objBytes, void* cd) {
+        int kind = GC_get_kind_and_size(obj, nullptr);
+
+        size_t index = HeapObjectKind::NumberOfKind;
+        for (size_t i = 0; i < HeapObjectKind::NumberOfKind; i++) {
+            if (s_gcKinds[i] == kind) {
+                index = i;
+                break;
+            }
+        }
+
+        LiveHeapObjectStatisticsData* statistics = (LiveHeapObjectStatisticsData*)cd;
+        statistics->bytes[index] += objBytes;
+        statistics->counts[index]++;
+    },
+                                         (void*)(&data));
+    GC_enable();
+}
+
 template <>
 Value* CustomAllocator<Value>::allocate(size_type GC_n, const void*)
 {
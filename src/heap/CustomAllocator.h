@@ -66,6 +66,14 @@ typedef std::function<void(ExecutionState& state, void* obj)> HeapObjectIterator
  */
 void iterateSpecificKindOfObject(ExecutionState& state, HeapObjectKind kind, HeapObjectIteratorCallback callback);
 
+/*
+ * This Function sums size and number of reachable objects of each kind.
+ * Objects which are not allocated by CustomAllocator are accumulated at index NumberOfKind,
+ * so bytes and counts should have (NumberOfKind + 1) entries.
+ * Like iterateSpecificKindOfObject, it calls GC_gcollect(). don't call this in performance-critical path.
+ */
+void computeLiveHeapObjectStatistics(size_t* bytes, size_t* counts);
+
 template <class GC_Tp>
 class CustomAllocator {
 public:
@@ -21,19 +21,72 @@
 
 #include "Heap.h"
 #include "LeakChecker.h"
+#include "util/Util.h"
 
 #include <stdlib.h>
 
 namespace Escargot {
 
-static bool g_isInited = false;
+static std::once_flag g_initFlag;
 
-void Heap::initialize(bool applyMallOpt, bool applyGcOpt)
+static Heap::GCPauseTimeHistogram g_gcPauseTimeHistogram;
+static uint64_t g_gcPauseStartTime;
+static bool g_gcPauseStartedByFullCollection;
+static bool g_isInGCPause = false;
+static GC_on_collection_event_proc g_previousGCEventListener;
+
+Heap::ObjectAllocationCounts Heap::s_objectAllocationCounts;
+
+static void recordGCPause(uint64_t pauseTime)
 {
-    if (g_isInited)
-        return;
+    size_t bucket = 0;
+    uint64_t bucketLimit = 1000;
+    while (pauseTime >= bucketLimit && bucket < Heap::GCPauseTimeHistogram::BucketCount - 1) {
+        bucket++;
+        bucketLimit *= 2;
+    }
+
+    g_gcPauseTimeHistogram.m_buckets[bucket]++;
+    g_gcPauseTimeHistogram.m_pauseCount++;
+    g_gcPauseTimeHistogram.m_totalPauseTime += pauseTime;
+    g_gcPauseTimeHistogram.m_maxPauseTime = std::max(g_gcPauseTimeHistogram.m_maxPauseTime, pauseTime);
+    g_gcPauseTimeHistogram.m_lastPauseTime = pauseTime;
+}
+
+// full collection sends START, MARK_START ... RECLAIM_END, END in stopped world
+// but incremental collection only stops the world from MARK_START to RECLAIM_END at the end of marking.
+// marking steps that incremental mode runs inside allocations send no event, so they are not recorded
+static void gcEventListener(GC_EventType evtType)
+{
+    if (!g_isInGCPause && (evtType == GC_EVENT_START || evtType == GC_EVENT_MARK_START)) {
+        g_isInGCPause = true;
+        g_gcPauseStartedByFullCollection = (evtType == GC_EVENT_START);
+        g_gcPauseStartTime = longTickCount();
+    } else if (g_isInGCPause && (evtType == (g_gcPauseStartedByFullCollection ? GC_EVENT_END : GC_EVENT_RECLAIM_END))) {
+        g_isInGCPause = false;
+        recordGCPause(longTickCount() - g_gcPauseStartTime);
+    }
+
+    if (g_previousGCEventListener) {
+        g_previousGCEventListener(evtType);
+    }
+}
+
+void Heap::initialize(bool applyMallOpt, bool applyGcOpt, bool enableIncrementalGC)
+{
+    std::call_once(g_initFlag, [=]() {
+        initializeOnce(applyMallOpt, applyGcOpt, enableIncrementalGC);
+    });
+}
+
+void Heap::initializeOnce(bool applyMallOpt, bool applyGcOpt, bool enableIncrementalGC)
+{
+    GC_INIT();
+#ifdef ESCARGOT_THREADING
+    // threads other than the one which initialized GC should be registered before they touch GC heap
+    GC_allow_register_threads();
+#endif
 
-    g_isInited = true;
     if (applyMallOpt) {
 #ifdef M_MMAP_THRESHOLD
         mallopt(M_MMAP_THRESHOLD, 2048);
@@ -48,11 +101,35 @@ void Heap::initialize(bool applyMallOpt, bool applyGcOpt)
     }
     GC_set_force_unmap_on_gcollect(1);
 
+    if (enableIncrementalGC) {
+        GC_enable_incremental();
+    }
+
     initializeCustomAllocators();
 
 #ifdef PROFILE_BDWGC
     GCUtil::HeapUsageVisualizer::initialize();
 #endif
+
+    resetGCPauseTimeHistogram();
+    g_previousGCEventListener = GC_get_on_collection_event();
+    GC_set_on_collection_event(gcEventListener);
+}
+
+void Heap::registerCurrentThread()
+{
+#ifdef ESCARGOT_THREADING
+    struct GC_stack_base stackBase;
+    GC_get_stack_base(&stackBase);
+    GC_register_my_thread(&stackBase);
+#endif
+}
+
+void Heap::unregisterCurrentThread()
+{
+#ifdef ESCARGOT_THREADING
+    GC_unregister_my_thread();
+#endif
 }
 
 void Heap::finalize()
@@ -61,4 +138,25 @@ void Heap::finalize()
         GC_gcollect_and_unmap();
     }
 }
+
+Heap::GCPauseTimeHistogram Heap::gcPauseTimeHistogram()
+{
+    // gcEventListener runs while GC holds allocation lock
+    GCPauseTimeHistogram result;
+    GC_call_with_alloc_lock([](void* data) -> void* {
+        memcpy(data, &g_gcPauseTimeHistogram, sizeof(GCPauseTimeHistogram));
+        return nullptr;
+    },
+                            &result);
+    return result;
+}
+
+void Heap::resetGCPauseTimeHistogram()
+{
+    GC_call_with_alloc_lock([](void*) -> void* {
+        memset(&g_gcPauseTimeHistogram, 0, sizeof(GCPauseTimeHistogram));
+        return nullptr;
+    },
+                            nullptr);
+}
 }
@@ -25,8 +25,77 @@ namespace Escargot {
 
 class Heap {
 public:
-    static void initialize(bool applyMallOpt = true, bool applyGcOpt = true);
+    // enableIncrementalGC turns on incremental and generational mode of bdwgc
+    // marking is done in small steps between allocations, and recently allocated objects
+    // are collected more often by using dirty bits of heap pages
+    static void initialize(bool applyMallOpt = true, bool applyGcOpt = true, bool enableIncrementalGC = false);
     static void finalize();
+
+    // with ESCARGOT_THREADING, every thread except the one called initialize should be registered
+    // before allocating from GC heap, so GC can stop it and scan its stack. these do nothing otherwise
+    static void registerCurrentThread();
+    static void unregisterCurrentThread();
+
+    // records stop-the-world phases of every collection (times are in microseconds)
+    // m_buckets[0] counts pauses shorter than 1ms, m_buckets[n] counts pauses in [2^(n-1), 2^n) ms
+    // and the last bucket counts every longer pause.
+    // with enableIncrementalGC, only the final phase of each cycle is recorded. small marking steps
+    // run inside allocations are not reported by bdwgc, so their time is not in the histogram
+    struct GCPauseTimeHistogram {
+        enum { BucketCount = 12 };
+        size_t m_buckets[BucketCount];
+        size_t m_pauseCount;
+        uint64_t m_totalPauseTime;
+        uint64_t m_maxPauseTime;
+        uint64_t m_lastPauseTime;
+    };
+
+    // GC records pauses in whichever thread collects, so these take GC allocation lock
+    static GCPauseTimeHistogram gcPauseTimeHistogram();
+    static void resetGCPauseTimeHistogram();
+
+    // VMInstances on several threads allocate at the same time, so counters are atomic.
+    // they are statistics only, so relaxed ordering is enough
+    class AllocationCounter {
+    public:
+        void increase()
+        {
+            m_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void decrease()
+        {
+            m_count.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        size_t value() const
+        {
+            return m_count.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<size_t> m_count;
+    };
+
+    // counters are bumped in operator new of each type, so they are cheap enough to keep always
+    // only ByteCodeBlock has a finalizer, so it is the only type we can count live objects of.
+    // like GC heap itself, they are process-wide and count objects of every VMInstance
+    struct ObjectAllocationCounts {
+        AllocationCounter m_objectStructureCount;
+        AllocationCounter m_stringCount;
+        AllocationCounter m_byteCodeBlockCount;
+        AllocationCounter m_liveByteCodeBlockCount;
+    };
+
+    static ObjectAllocationCounts& objectAllocationCounts()
+    {
+        return s_objectAllocationCounts;
+    }
+
+private:
+    static void initializeOnce(bool applyMallOpt, bool applyGcOpt, bool enableIncrementalGC);
+
+    static ObjectAllocationCounts s_objectAllocationCounts;
 };
 }
 
@@ -29,6 +29,7 @@
 namespace Escargot {
 
 OpcodeTable g_opcodeTable;
+GetObjectInlineCache GetObjectInlineCache::s_emptyCache;
 
 OpcodeTable::OpcodeTable()
 {
@@ -37,23 +38,21 @@ OpcodeTable::OpcodeTable()
 
     block.m_code.resize(sizeof(FillOpcodeTable));
 #if defined(COMPILER_GCC)
-    size_t* addr = (size_t*)(block.m_code.data() + offsetof(FillOpcodeTable, m_opcodeInAddress));
+    int32_t* addr = (int32_t*)(block.m_code.data() + offsetof(FillOpcodeTable, m_opcodeOffset));
     ByteCodeInterpreter::interpret(state, &block, 0, nullptr, addr);
 #endif
 }
 
 void* ByteCodeBlock::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(ByteCodeBlock)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ByteCodeBlock, m_literalData));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ByteCodeBlock, m_codeBlock));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ByteCodeBlock, m_objectStructuresInUse));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ByteCodeBlock));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ByteCodeBlock));
+    }();
+    Heap::objectAllocationCounts().m_byteCodeBlockCount.increase();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
@@ -130,30 +129,24 @@ ExtendedNodeLOC ByteCodeBlock::computeNodeLOC(StringView src, ExtendedNodeLOC so
 
 void* SetObjectInlineCache::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(SetObjectInlineCache)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetObjectInlineCache, m_cachedhiddenClassChain));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetObjectInlineCache, m_hiddenClassWillBe));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SetObjectInlineCache));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SetObjectInlineCache));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
 void* EnumerateObjectData::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(EnumerateObjectData)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(EnumerateObjectData, m_hiddenClassChain));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(EnumerateObjectData, m_object));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(EnumerateObjectData, m_keys));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(EnumerateObjectData));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(EnumerateObjectData));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 }
@@ -38,6 +38,9 @@ class Node;
     F(StoreByName, 0, 0)                              \
     F(LoadByHeapIndex, 1, 0)                          \
     F(StoreByHeapIndex, 0, 0)                         \
+    F(LoadArgumentsObject, 1, 0)                      \
+    F(GetArgumentsLength, 1, 0)                       \
+    F(GetArgumentsElement, 1, 1)                      \
     F(DeclareFunctionDeclarations, 1, 0)              \
     F(NewOperation, 1, 0)                             \
     F(BinaryPlus, 1, 2)                               \
@@ -124,7 +127,8 @@ enum Opcode {
 #endif
 
 struct OpcodeTable {
-    void* m_table[OpcodeKindEnd];
+    // offset of each opcode label from FillOpcodeTable label in ByteCodeInterpreter::interpret
+    int32_t m_table[OpcodeKindEnd];
     OpcodeTable();
 };
 
@@ -172,7 +176,7 @@ public:
 #endif
     ByteCode(Opcode code, const ByteCodeLOC& loc)
 #if defined(COMPILER_GCC)
-        : m_opcodeInAddress((void*)code)
+        : m_opcodeOffset((int32_t)code)
 #else
         : m_opcode(code)
 #endif
@@ -183,22 +187,23 @@ public:
     {
     }
 
-    void assignOpcodeInAddress()
+    void assignOpcodeOffset()
     {
 #ifndef NDEBUG
 #if defined(COMPILER_GCC)
-        m_orgOpcode = (Opcode)(size_t)m_opcodeInAddress;
+        m_orgOpcode = (Opcode)m_opcodeOffset;
 #else
         m_orgOpcode = m_opcode;
 #endif
 #endif
 #if defined(COMPILER_GCC)
-        m_opcodeInAddress = g_opcodeTable.m_table[(Opcode)(size_t)m_opcodeInAddress];
+        m_opcodeOffset = g_opcodeTable.m_table[(Opcode)m_opcodeOffset];
 #endif
     }
 
 #if defined(COMPILER_GCC)
-    void* m_opcodeInAddress;
+    // 32-bit offset instead of label address, so narrow operands of bytecode are packed next to it
+    int32_t m_opcodeOffset;
 #else
     Opcode m_opcode;
 #endif
@@ -221,6 +226,10 @@ public:
 #endif
 };
 
+#ifdef NDEBUG
+COMPILE_ASSERT(sizeof(ByteCode) == sizeof(int32_t), "");
+#endif
+
 class LoadLiteral : public ByteCode {
 public:
     LoadLiteral(const ByteCodeLOC& loc, const size_t& registerIndex, const Value& v)
@@ -334,6 +343,73 @@ public:
 #endif
 };
 
+// arguments of a function which has lazy arguments object is empty until someone needs the object
+// these read it, and GetArguments* reads length or element from argc, argv of the function without creating it
+class LoadArgumentsObject : public ByteCode {
+public:
+    LoadArgumentsObject(const ByteCodeLOC& loc, const size_t& argumentsIndex, const size_t& registerIndex, const size_t& upperIndex)
+        : ByteCode(Opcode::LoadArgumentsObjectOpcode, loc)
+        , m_argumentsIndex(argumentsIndex)
+        , m_registerIndex(registerIndex)
+        , m_upperIndex(upperIndex)
+    {
+    }
+    ByteCodeRegisterIndex m_argumentsIndex;
+    ByteCodeRegisterIndex m_registerIndex;
+    ByteCodeRegisterIndex m_upperIndex;
+
+#ifndef NDEBUG
+    virtual void dump()
+    {
+        printf("load arguments r%d <- r%d", (int)m_registerIndex, (int)m_argumentsIndex);
+    }
+#endif
+};
+
+class GetArgumentsLength : public ByteCode {
+public:
+    GetArgumentsLength(const ByteCodeLOC& loc, const size_t& argumentsIndex, const size_t& storeRegisterIndex, const size_t& upperIndex)
+        : ByteCode(Opcode::GetArgumentsLengthOpcode, loc)
+        , m_argumentsIndex(argumentsIndex)
+        , m_storeRegisterIndex(storeRegisterIndex)
+        , m_upperIndex(upperIndex)
+    {
+    }
+    ByteCodeRegisterIndex m_argumentsIndex;
+    ByteCodeRegisterIndex m_storeRegisterIndex;
+    ByteCodeRegisterIndex m_upperIndex;
+
+#ifndef NDEBUG
+    virtual void dump()
+    {
+        printf("get arguments length r%d <- r%d", (int)m_storeRegisterIndex, (int)m_argumentsIndex);
+    }
+#endif
+};
+
+class GetArgumentsElement : public ByteCode {
+public:
+    GetArgumentsElement(const ByteCodeLOC& loc, const size_t& argumentsIndex, const size_t& propertyRegisterIndex, const size_t& storeRegisterIndex, const size_t& upperIndex)
+        : ByteCode(Opcode::GetArgumentsElementOpcode, loc)
+        , m_argumentsIndex(argumentsIndex)
+        , m_propertyRegisterIndex(propertyRegisterIndex)
+        , m_storeRegisterIndex(storeRegisterIndex)
+        , m_upperIndex(upperIndex)
+    {
+    }
+    ByteCodeRegisterIndex m_argumentsIndex;
+    ByteCodeRegisterIndex m_propertyRegisterIndex;
+    ByteCodeRegisterIndex m_storeRegisterIndex;
+    ByteCodeRegisterIndex m_upperIndex;
+
+#ifndef NDEBUG
+    virtual void dump()
+    {
+        printf("get arguments element r%d <- r%d[r%d]", (int)m_storeRegisterIndex, (int)m_argumentsIndex, (int)m_propertyRegisterIndex);
+    }
+#endif
+};
+
 class DeclareFunctionDeclarations : public ByteCode {
 public:
     explicit DeclareFunctionDeclarations(InterpretedCodeBlock* cb)
@@ -621,15 +697,24 @@ struct GetObjectInlineCacheData {
 
 typedef std::vector<GetObjectInlineCacheData, std::allocator<GetObjectInlineCacheData>> GetObjectInlineCacheDataVector;
 
+// GetObjectInlineCache is allocated out of ByteCodeBlock::m_code when its bytecode fills cache first time
+// so code size is not grown by caches of bytecodes never cached.
+// until then, bytecode points s_emptyCache which always misses, so fast path needs no null check
 struct GetObjectInlineCache {
     GetObjectInlineCache()
     {
-        m_cacheMissCount = m_executeCount = 0;
+        m_cacheMissCount = 0;
+    }
+
+    bool isEmptyCache()
+    {
+        return this == &s_emptyCache;
     }
 
     GetObjectInlineCacheDataVector m_cache;
-    uint16_t m_executeCount;
     uint16_t m_cacheMissCount;
+
+    static GetObjectInlineCache s_emptyCache;
 };
 
 class GetObjectPreComputedCase : public ByteCode {
@@ -639,14 +724,17 @@ public:
         : ByteCode(Opcode::GetObjectPreComputedCaseOpcode, loc)
         , m_objectRegisterIndex(objectRegisterIndex)
         , m_storeRegisterIndex(storeRegisterIndex)
+        , m_executeCount(0)
         , m_propertyName(propertyName)
+        , m_inlineCache(&GetObjectInlineCache::s_emptyCache)
     {
     }
 
-    GetObjectInlineCache m_inlineCache;
     ByteCodeRegisterIndex m_objectRegisterIndex;
     ByteCodeRegisterIndex m_storeRegisterIndex;
+    uint16_t m_executeCount;
     PropertyName m_propertyName;
+    GetObjectInlineCache* m_inlineCache;
 #ifndef NDEBUG
     virtual void dump()
     {
@@ -1389,13 +1477,15 @@ struct EnumerateObjectData : public PointerValue {
         m_object = nullptr;
         m_originalLength = 0;
         m_idx = 0;
+        m_keys = nullptr;
     }
 
     ObjectStructureChainWithGC m_hiddenClassChain;
     Object* m_object;
     uint64_t m_originalLength;
     size_t m_idx;
-    SmallValueVector m_keys;
+    // it can be the key vector of ObjectStructureEnumerationCache, so it should not be modified
+    SmallValueVector* m_keys;
 
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
@@ -1591,10 +1681,15 @@ public:
             m_objectStructuresInUse = nullptr;
         }
 
+        Heap::objectAllocationCounts().m_liveByteCodeBlockCount.increase();
         GC_REGISTER_FINALIZER_NO_ORDER(this, [](void* obj, void*) {
             ByteCodeBlock* self = (ByteCodeBlock*)obj;
+            Heap::objectAllocationCounts().m_liveByteCodeBlockCount.decrease();
             for (size_t i = 0; i < self->m_getObjectCodePositions.size(); i++) {
-                GetObjectInlineCacheDataVector().swap(((GetObjectPreComputedCase*)((size_t)self->m_code.data() + self->m_getObjectCodePositions[i]))->m_inlineCache.m_cache);
+                GetObjectInlineCache* inlineCache = ((GetObjectPreComputedCase*)((size_t)self->m_code.data() + self->m_getObjectCodePositions[i]))->m_inlineCache;
+                if (!inlineCache->isEmptyCache()) {
+                    delete inlineCache;
+                }
             }
             std::vector<size_t>().swap(self->m_getObjectCodePositions);
 
@@ -1665,6 +1760,12 @@ public:
         siz += m_literalData.size() * sizeof(size_t);
         siz += m_objectStructuresInUse->size() * sizeof(size_t);
         siz += m_getObjectCodePositions.size() * sizeof(size_t);
+        for (size_t i = 0; i < m_getObjectCodePositions.size(); i++) {
+            GetObjectInlineCache* inlineCache = ((GetObjectPreComputedCase*)((size_t)m_code.data() + m_getObjectCodePositions[i]))->m_inlineCache;
+            if (!inlineCache->isEmptyCache()) {
+                siz += sizeof(GetObjectInlineCache);
+            }
+        }
         return siz;
     }
 
@@ -201,6 +201,7 @@ ByteCodeBlock* ByteCodeGenerator::generateByteCode(Context* c, InterpretedCodeBl
         }
     } catch (const ByteCodeGenerateError& err) {
         block->m_code.clear();
+        ctx.m_getObjectCodePositions.clear();
         char* data = (char*)GC_MALLOC_ATOMIC(err.m_message.size());
         memcpy(data, err.m_message.data(), err.m_message.size());
         data[err.m_message.size()] = 0;
@@ -240,11 +241,11 @@ ByteCodeBlock* ByteCodeGenerator::generateByteCode(Context* c, InterpretedCodeBl
         while (&code[idx] < end) {
             ByteCode* currentCode = (ByteCode*)(&code[idx]);
 #if defined(COMPILER_GCC)
-            Opcode opcode = (Opcode)(size_t)currentCode->m_opcodeInAddress;
+            Opcode opcode = (Opcode)currentCode->m_opcodeOffset;
 #else
             Opcode opcode = currentCode->m_opcode;
 #endif
-            currentCode->assignOpcodeInAddress();
+            currentCode->assignOpcodeOffset();
 
             switch (opcode) {
             case LoadLiteralOpcode: {
@@ -277,6 +278,25 @@ ByteCodeBlock* ByteCodeGenerator::generateByteCode(Context* c, InterpretedCodeBl
                 assignStackIndexIfNeeded(cd->m_registerIndex, stackBase, stackBaseWillBe, stackVariableSize);
                 break;
             }
+            case LoadArgumentsObjectOpcode: {
+                LoadArgumentsObject* cd = (LoadArgumentsObject*)currentCode;
+                assignStackIndexIfNeeded(cd->m_argumentsIndex, stackBase, stackBaseWillBe, stackVariableSize);
+                assignStackIndexIfNeeded(cd->m_registerIndex, stackBase, stackBaseWillBe, stackVariableSize);
+                break;
+            }
+            case GetArgumentsLengthOpcode: {
+                GetArgumentsLength* cd = (GetArgumentsLength*)currentCode;
+                assignStackIndexIfNeeded(cd->m_argumentsIndex, stackBase, stackBaseWillBe, stackVariableSize);
+                assignStackIndexIfNeeded(cd->m_storeRegisterIndex, stackBase, stackBaseWillBe, stackVariableSize);
+                break;
+            }
+            case GetArgumentsElementOpcode: {
+                GetArgumentsElement* cd = (GetArgumentsElement*)currentCode;
+                assignStackIndexIfNeeded(cd->m_argumentsIndex, stackBase, stackBaseWillBe, stackVariableSize);
+                assignStackIndexIfNeeded(cd->m_propertyRegisterIndex, stackBase, stackBaseWillBe, stackVariableSize);
+                assignStackIndexIfNeeded(cd->m_storeRegisterIndex, stackBase, stackBaseWillBe, stackVariableSize);
+                break;
+            }
             case CreateFunctionOpcode: {
                 CreateFunction* cd = (CreateFunction*)currentCode;
                 assignStackIndexIfNeeded(cd->m_registerIndex, stackBase, stackBaseWillBe, stackVariableSize);
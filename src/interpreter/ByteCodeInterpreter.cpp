@@ -30,6 +30,7 @@
 #include "runtime/NumberObject.h"
 #include "runtime/ErrorObject.h"
 #include "runtime/ArrayObject.h"
+#include "runtime/SamplingProfiler.h"
 #include "parser/ScriptParser.h"
 #include "util/Util.h"
 #include "../third_party/checked_arithmetic/CheckedArithmetic.h"
@@ -55,19 +56,24 @@ ALWAYS_INLINE size_t resolveProgramCounter(char* codeBuffer, const size_t progra
 Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteCodeBlock, size_t programCounter, Value* registerFile, void* initAddressFiller)
 {
 #if defined(COMPILER_GCC)
-    *((size_t*)initAddressFiller) = ((size_t) && FillOpcodeTableOpcodeLbl);
+    // opcode offsets are relative to FillOpcodeTable label
+    *((int32_t*)initAddressFiller) = 0;
 #endif
     {
         ExecutionContext* ec = state.executionContext();
         char* codeBuffer = byteCodeBlock->m_code.data();
         programCounter = (size_t)(&codeBuffer[programCounter]);
 
+        if (UNLIKELY(SamplingProfiler::isSampleRequested())) {
+            SamplingProfiler::takeSample(state, byteCodeBlock, programCounter - (size_t)codeBuffer);
+        }
+
         try {
 #define NEXT_INSTRUCTION() goto NextInstruction;
 
         NextInstruction:
 #if defined(COMPILER_GCC)
-            goto*(((ByteCode*)programCounter)->m_opcodeInAddress);
+            goto*((char*)&&FillOpcodeTableOpcodeLbl + ((ByteCode*)programCounter)->m_opcodeOffset);
 #else
             Opcode currentOpcode = ((ByteCode*)programCounter)->m_opcode;
         NextInstructionWithoutFetchOpcode:
@@ -389,7 +395,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                     if (LIKELY(arr->isFastModeArray())) {
                         uint32_t idx = property.tryToUseAsArrayIndex(state);
                         if (LIKELY(idx != Value::InvalidArrayIndexValue) && LIKELY(idx < arr->getArrayLength(state))) {
-                            const Value& v = arr->m_fastModeData[idx];
+                            Value v = arr->getFastModeElement(idx);
                             if (LIKELY(!v.isEmpty())) {
                                 registerFile[code->m_storeRegisterIndex] = v;
                                 ADD_PROGRAM_COUNTER(GetObject);
@@ -436,7 +442,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
 #endif
                                 }
                             }
-                            arr->m_fastModeData[idx] = registerFile[code->m_loadRegisterIndex];
+                            arr->setFastModeElement(idx, registerFile[code->m_loadRegisterIndex]);
                             ADD_PROGRAM_COUNTER(SetObjectOperation);
                             NEXT_INSTRUCTION();
                         }
@@ -461,7 +467,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 } else {
                     obj = fastToObject(state, willBeObject);
                 }
-                registerFile[code->m_storeRegisterIndex] = getObjectPrecomputedCaseOperation(state, obj, willBeObject, code->m_propertyName, code->m_inlineCache, byteCodeBlock);
+                registerFile[code->m_storeRegisterIndex] = getObjectPrecomputedCaseOperation(state, obj, willBeObject, code, byteCodeBlock);
                 ADD_PROGRAM_COUNTER(GetObjectPreComputedCase);
                 NEXT_INSTRUCTION();
             }
@@ -480,6 +486,10 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
             {
                 Jump* code = (Jump*)programCounter;
                 ASSERT(code->m_jumpPosition != SIZE_MAX);
+                // backward jumps are safepoints of sampling profiler
+                if (UNLIKELY(SamplingProfiler::isSampleRequested()) && code->m_jumpPosition < programCounter) {
+                    SamplingProfiler::takeSample(state, byteCodeBlock, programCounter - (size_t)codeBuffer);
+                }
                 programCounter = code->m_jumpPosition;
                 NEXT_INSTRUCTION();
             }
@@ -490,6 +500,9 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 JumpIfTrue* code = (JumpIfTrue*)programCounter;
                 ASSERT(code->m_jumpPosition != SIZE_MAX);
                 if (registerFile[code->m_registerIndex].toBoolean(state)) {
+                    if (UNLIKELY(SamplingProfiler::isSampleRequested()) && code->m_jumpPosition < programCounter) {
+                        SamplingProfiler::takeSample(state, byteCodeBlock, programCounter - (size_t)codeBuffer);
+                    }
                     programCounter = code->m_jumpPosition;
                 } else {
                     ADD_PROGRAM_COUNTER(JumpIfTrue);
@@ -503,6 +516,9 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 JumpIfFalse* code = (JumpIfFalse*)programCounter;
                 ASSERT(code->m_jumpPosition != SIZE_MAX);
                 if (!registerFile[code->m_registerIndex].toBoolean(state)) {
+                    if (UNLIKELY(SamplingProfiler::isSampleRequested()) && code->m_jumpPosition < programCounter) {
+                        SamplingProfiler::takeSample(state, byteCodeBlock, programCounter - (size_t)codeBuffer);
+                    }
                     programCounter = code->m_jumpPosition;
                 } else {
                     ADD_PROGRAM_COUNTER(JumpIfFalse);
@@ -526,7 +542,14 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 CallFunctionWithReceiver* code = (CallFunctionWithReceiver*)programCounter;
                 const Value& callee = registerFile[code->m_calleeIndex];
                 const Value& receiver = registerFile[code->m_receiverIndex];
-                registerFile[code->m_resultIndex] = FunctionObject::call(state, callee, receiver, code->m_argumentCount, &registerFile[code->m_argumentsStartIndex]);
+                Value* argv = &registerFile[code->m_argumentsStartIndex];
+                // f.call(thisArg, ...) calls f directly without a frame for Function.prototype.call
+                if (UNLIKELY(callee.isPointerValue() && callee.asPointerValue() == state.context()->globalObject()->functionPrototypeCall() && receiver.isFunction())) {
+                    size_t argc = code->m_argumentCount;
+                    registerFile[code->m_resultIndex] = FunctionObject::call(state, receiver, argc ? argv[0] : Value(), argc ? argc - 1 : 0, argv + 1);
+                } else {
+                    registerFile[code->m_resultIndex] = FunctionObject::call(state, callee, receiver, code->m_argumentCount, argv);
+                }
                 ADD_PROGRAM_COUNTER(CallFunctionWithReceiver);
                 NEXT_INSTRUCTION();
             }
@@ -561,6 +584,57 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 NEXT_INSTRUCTION();
             }
 
+            DEFINE_OPCODE(LoadArgumentsObject)
+                :
+            {
+                LoadArgumentsObject* code = (LoadArgumentsObject*)programCounter;
+                Value& arguments = registerFile[code->m_argumentsIndex];
+                if (UNLIKELY(arguments.isEmpty())) {
+                    arguments = createLazyArgumentsObject(state, ec, code->m_upperIndex);
+                }
+                registerFile[code->m_registerIndex] = arguments;
+                ADD_PROGRAM_COUNTER(LoadArgumentsObject);
+                NEXT_INSTRUCTION();
+            }
+
+            DEFINE_OPCODE(GetArgumentsLength)
+                :
+            {
+                GetArgumentsLength* code = (GetArgumentsLength*)programCounter;
+                const Value& arguments = registerFile[code->m_argumentsIndex];
+                if (LIKELY(arguments.isEmpty())) {
+                    registerFile[code->m_storeRegisterIndex] = Value(lazyArgumentsRecord(ec, code->m_upperIndex)->argc());
+                } else {
+                    Object* obj = arguments.isObject() ? arguments.asObject() : fastToObject(state, arguments);
+                    registerFile[code->m_storeRegisterIndex] = obj->get(state, ObjectPropertyName(state.context()->staticStrings().length)).value(state, arguments);
+                }
+                ADD_PROGRAM_COUNTER(GetArgumentsLength);
+                NEXT_INSTRUCTION();
+            }
+
+            DEFINE_OPCODE(GetArgumentsElement)
+                :
+            {
+                GetArgumentsElement* code = (GetArgumentsElement*)programCounter;
+                Value& arguments = registerFile[code->m_argumentsIndex];
+                const Value& property = registerFile[code->m_propertyRegisterIndex];
+                if (LIKELY(arguments.isEmpty())) {
+                    FunctionEnvironmentRecord* record = lazyArgumentsRecord(ec, code->m_upperIndex);
+                    uint32_t idx = property.tryToUseAsArrayIndex(state);
+                    if (LIKELY(idx != Value::InvalidArrayIndexValue && idx < record->argc())) {
+                        registerFile[code->m_storeRegisterIndex] = record->argv()[idx];
+                        ADD_PROGRAM_COUNTER(GetArgumentsElement);
+                        NEXT_INSTRUCTION();
+                    }
+                    // other properties may come from prototype chain
+                    arguments = record->createArgumentsObject(state, ec);
+                }
+                Object* obj = arguments.isObject() ? arguments.asObject() : fastToObject(state, arguments);
+                registerFile[code->m_storeRegisterIndex] = obj->getIndexedProperty(state, property).value(state, arguments);
+                ADD_PROGRAM_COUNTER(GetArgumentsElement);
+                NEXT_INSTRUCTION();
+            }
+
             DEFINE_OPCODE(BinaryMod)
                 :
             {
@@ -741,7 +815,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                     size_t end = code->m_count + code->m_baseIndex;
                     for (size_t i = 0; i < code->m_count; i++) {
                         if (LIKELY(code->m_loadRegisterIndexs[i] != std::numeric_limits<ByteCodeRegisterIndex>::max())) {
-                            arr->m_fastModeData[i + code->m_baseIndex] = registerFile[code->m_loadRegisterIndexs[i]];
+                            arr->setFastModeElement(i + code->m_baseIndex, registerFile[code->m_loadRegisterIndexs[i]]);
                         }
                     }
                 } else {
@@ -970,7 +1044,8 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 EnumerateObjectData* data = (EnumerateObjectData*)registerFile[code->m_registerIndex].asPointerValue();
                 bool shouldUpdateEnumerateObjectData = false;
                 Object* obj = data->m_object;
-                for (size_t i = 0; i < data->m_hiddenClassChain.size(); i++) {
+                size_t chainSize = data->m_hiddenClassChain.size();
+                for (size_t i = 0; i < chainSize; i++) {
                     auto hc = data->m_hiddenClassChain[i];
                     ObjectStructureChainItem testItem;
                     testItem.m_objectStructure = obj->structure();
@@ -978,6 +1053,9 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                         shouldUpdateEnumerateObjectData = true;
                         break;
                     }
+                    if (i + 1 == chainSize) {
+                        break;
+                    }
                     Value val = obj->getPrototype(state);
                     if (val.isObject()) {
                         obj = val.asObject();
@@ -998,7 +1076,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                     data = (EnumerateObjectData*)registerFile[code->m_registerIndex].asPointerValue();
                 }
 
-                if (data->m_keys.size() <= data->m_idx) {
+                if (data->m_keys->size() <= data->m_idx) {
                     programCounter = jumpTo(codeBuffer, code->m_forInEndPosition);
                 } else {
                     ADD_PROGRAM_COUNTER(CheckIfKeyIsLast);
@@ -1012,7 +1090,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
                 EnumerateObjectKey* code = (EnumerateObjectKey*)programCounter;
                 EnumerateObjectData* data = (EnumerateObjectData*)registerFile[code->m_dataRegisterIndex].asPointerValue();
                 data->m_idx++;
-                registerFile[code->m_registerIndex] = Value(data->m_keys[data->m_idx - 1]).toString(state);
+                registerFile[code->m_registerIndex] = Value((*data->m_keys)[data->m_idx - 1]).toString(state);
                 ADD_PROGRAM_COUNTER(EnumerateObjectKey);
                 NEXT_INSTRUCTION();
             }
@@ -1145,7 +1223,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState& state, ByteCodeBlock* byteC
 #if defined(COMPILER_GCC)
 FillOpcodeTableOpcodeLbl:
 {
-#define REGISTER_TABLE(opcode, pushCount, popCount) g_opcodeTable.m_table[opcode##Opcode] = &&opcode##OpcodeLbl;
+#define REGISTER_TABLE(opcode, pushCount, popCount) g_opcodeTable.m_table[opcode##Opcode] = (int32_t)((char*)&&opcode##OpcodeLbl - (char*)&&FillOpcodeTableOpcodeLbl);
     FOR_EACH_BYTECODE_OP(REGISTER_TABLE);
 #undef REGISTER_TABLE
     return Value();
@@ -1416,11 +1494,12 @@ NEVER_INLINE bool ByteCodeInterpreter::abstractRelationalComparisonOrEqualSlowCa
     }
 }
 
-ALWAYS_INLINE Value ByteCodeInterpreter::getObjectPrecomputedCaseOperation(ExecutionState& state, Object* obj, const Value& receiver, const PropertyName& name, GetObjectInlineCache& inlineCache, ByteCodeBlock* block)
+ALWAYS_INLINE Value ByteCodeInterpreter::getObjectPrecomputedCaseOperation(ExecutionState& state, Object* obj, const Value& receiver, GetObjectPreComputedCase* code, ByteCodeBlock* block)
 {
     Object* orgObj = obj;
-    const size_t cacheFillCount = inlineCache.m_cache.size();
-    GetObjectInlineCacheData* cacheData = inlineCache.m_cache.data();
+    GetObjectInlineCache* inlineCache = code->m_inlineCache;
+    const size_t cacheFillCount = inlineCache->m_cache.size();
+    GetObjectInlineCacheData* cacheData = inlineCache->m_cache.data();
     unsigned currentCacheIndex = 0;
 TestCache:
     for (; currentCacheIndex < cacheFillCount; currentCacheIndex++) {
@@ -1453,24 +1532,26 @@ TestCache:
         }
     }
 
-    return getObjectPrecomputedCaseOperationCacheMiss(state, orgObj, receiver, name, inlineCache, block);
+    return getObjectPrecomputedCaseOperationCacheMiss(state, orgObj, receiver, code, block);
 }
 
-NEVER_INLINE Value ByteCodeInterpreter::getObjectPrecomputedCaseOperationCacheMiss(ExecutionState& state, Object* obj, const Value& receiver, const PropertyName& name, GetObjectInlineCache& inlineCache, ByteCodeBlock* block)
+NEVER_INLINE Value ByteCodeInterpreter::getObjectPrecomputedCaseOperationCacheMiss(ExecutionState& state, Object* obj, const Value& receiver, GetObjectPreComputedCase* code, ByteCodeBlock* block)
 {
     const int maxCacheMissCount = 16;
     const int minCacheFillCount = 3;
     const size_t maxCacheCount = 10;
+    const PropertyName& name = code->m_propertyName;
     // cache miss.
-    inlineCache.m_executeCount++;
-    if (inlineCache.m_executeCount <= minCacheFillCount) {
+    code->m_executeCount++;
+    if (code->m_executeCount <= minCacheFillCount) {
         return obj->get(state, ObjectPropertyName(state, name)).value(state, receiver);
     }
 
-    if (inlineCache.m_cache.size())
-        inlineCache.m_cacheMissCount++;
+    // s_emptyCache has no entry, so it is never written before replaced below
+    if (code->m_inlineCache->m_cache.size())
+        code->m_inlineCache->m_cacheMissCount++;
 
-    if (inlineCache.m_cache.size() > maxCacheCount) {
+    if (code->m_inlineCache->m_cache.size() > maxCacheCount) {
         return obj->get(state, ObjectPropertyName(state, name)).value(state, receiver);
     }
 
@@ -1478,6 +1559,11 @@ NEVER_INLINE Value ByteCodeInterpreter::getObjectPrecomputedCaseOperationCacheMi
         return obj->get(state, ObjectPropertyName(state, name)).value(state, receiver);
     }
 
+    if (code->m_inlineCache->isEmptyCache()) {
+        code->m_inlineCache = new GetObjectInlineCache();
+    }
+    GetObjectInlineCache& inlineCache = *code->m_inlineCache;
+
     Object* orgObj = obj;
     inlineCache.m_cache.insert(inlineCache.m_cache.begin(), GetObjectInlineCacheData());
 
@@ -1644,6 +1730,32 @@ NEVER_INLINE EnumerateObjectData* ByteCodeInterpreter::executeEnumerateObject(Ex
     data->m_originalLength = 0;
     if (obj->isArrayObject())
         data->m_originalLength = obj->length(state);
+
+    // when no object of prototype chain has enumerable key, keys of structure can be used as they are.
+    // only own structure needs to be checked while iterating, because properties added to prototypes
+    // after the loop started are not guaranteed to be visited
+    if (ObjectStructureEnumerationCache* cache = obj->enumerationCache()) {
+        bool canUseCache = true;
+        Value proto = obj->getPrototype(state);
+        while (proto.isObject()) {
+            ObjectStructureEnumerationCache* protoCache = proto.asObject()->enumerationCache();
+            if (!protoCache || protoCache->m_keys.size()) {
+                canUseCache = false;
+                break;
+            }
+            proto = proto.asObject()->getPrototype(state);
+        }
+
+        if (canUseCache) {
+            ObjectStructureChainItem item;
+            item.m_objectStructure = obj->structure();
+            data->m_hiddenClassChain.push_back(item);
+            data->m_keys = &cache->m_keys;
+            return data;
+        }
+    }
+
+    data->m_keys = new SmallValueVector();
     Value target = data->m_object;
 
     size_t ownKeyCount = 0;
@@ -1703,7 +1815,7 @@ NEVER_INLINE EnumerateObjectData* ByteCodeInterpreter::executeEnumerateObject(Ex
                     auto iter = eData->keyStringSet->find(key);
                     if (iter == eData->keyStringSet->end()) {
                         eData->keyStringSet->insert(key);
-                        eData->data->m_keys.pushBack(name.toPlainValue(state));
+                        eData->data->m_keys->pushBack(name.toPlainValue(state));
                     }
                 } else if (self == eData->obj) {
                     // 12.6.4 The values of [[Enumerable]] attributes are not considered
@@ -1720,11 +1832,11 @@ NEVER_INLINE EnumerateObjectData* ByteCodeInterpreter::executeEnumerateObject(Ex
     } else {
         size_t idx = 0;
         eData.idx = &idx;
-        data->m_keys.resizeWithUninitializedValues(ownKeyCount);
+        data->m_keys->resizeWithUninitializedValues(ownKeyCount);
         target.asObject()->enumeration(state, [](ExecutionState& state, Object* self, const ObjectPropertyName& name, const ObjectStructurePropertyDescriptor& desc, void* data) -> bool {
             if (desc.isEnumerable()) {
                 EData* eData = (EData*)data;
-                eData->data->m_keys[(*eData->idx)++] = name.toPlainValue(state);
+                (*eData->data->m_keys)[(*eData->idx)++] = name.toPlainValue(state);
             }
             return true;
         },
@@ -1741,13 +1853,15 @@ NEVER_INLINE EnumerateObjectData* ByteCodeInterpreter::executeEnumerateObject(Ex
 NEVER_INLINE EnumerateObjectData* ByteCodeInterpreter::updateEnumerateObjectData(ExecutionState& state, EnumerateObjectData* data)
 {
     EnumerateObjectData* newData = executeEnumerateObject(state, data->m_object);
+    SmallValueVector& oldKeyVector = *data->m_keys;
+    SmallValueVector& newKeyVector = *newData->m_keys;
     std::vector<Value, GCUtil::gc_malloc_ignore_off_page_allocator<Value>> oldKeys;
-    if (data->m_keys.size()) {
-        oldKeys.insert(oldKeys.end(), &data->m_keys[0], &data->m_keys[data->m_keys.size() - 1] + 1);
+    if (oldKeyVector.size()) {
+        oldKeys.insert(oldKeys.end(), &oldKeyVector[0], &oldKeyVector[oldKeyVector.size() - 1] + 1);
     }
     std::vector<Value, GCUtil::gc_malloc_ignore_off_page_allocator<Value>> differenceKeys;
-    for (size_t i = 0; i < newData->m_keys.size(); i++) {
-        const Value& key = newData->m_keys[i];
+    for (size_t i = 0; i < newKeyVector.size(); i++) {
+        const Value& key = newKeyVector[i];
         // If a property that has not yet been visited during enumeration is deleted, then it will not be visited.
         if (std::find(oldKeys.begin(), oldKeys.begin() + data->m_idx, key) == oldKeys.begin() + data->m_idx && std::find(oldKeys.begin() + data->m_idx, oldKeys.end(), key) != oldKeys.end()) {
             // If new properties are added to the object being enumerated during enumeration,
@@ -1756,10 +1870,11 @@ NEVER_INLINE EnumerateObjectData* ByteCodeInterpreter::updateEnumerateObjectData
         }
     }
     data = newData;
-    data->m_keys.clear();
-    data->m_keys.resizeWithUninitializedValues(differenceKeys.size());
+    // keys of newData can be shared with enumeration cache, so make a new vector
+    data->m_keys = new SmallValueVector();
+    data->m_keys->resizeWithUninitializedValues(differenceKeys.size());
     for (size_t i = 0; i < differenceKeys.size(); i++) {
-        data->m_keys[i] = differenceKeys[i];
+        (*data->m_keys)[i] = differenceKeys[i];
     }
     return data;
 }
@@ -2114,6 +2229,22 @@ NEVER_INLINE void ByteCodeInterpreter::defineObjectSetter(ExecutionState& state,
     registerFile[code->m_objectRegisterIndex].toObject(state)->defineOwnPropertyThrowsExceptionWhenStrictMode(state, ObjectPropertyName(state, pName), desc);
 }
 
+FunctionEnvironmentRecord* ByteCodeInterpreter::lazyArgumentsRecord(ExecutionContext* ec, size_t upperIndex)
+{
+    LexicalEnvironment* env = ec->lexicalEnvironment();
+    for (size_t i = 0; i < upperIndex; i++) {
+        env = env->outerEnvironment();
+    }
+    FunctionEnvironmentRecord* record = env->record()->asDeclarativeEnvironmentRecord()->asFunctionEnvironmentRecord();
+    ASSERT(record->isFunctionEnvironmentRecordOnHeap());
+    return record;
+}
+
+NEVER_INLINE Value ByteCodeInterpreter::createLazyArgumentsObject(ExecutionState& state, ExecutionContext* ec, size_t upperIndex)
+{
+    return lazyArgumentsRecord(ec, upperIndex)->createArgumentsObject(state, ec);
+}
+
 NEVER_INLINE void ByteCodeInterpreter::processException(ExecutionState& state, const Value& value, ExecutionContext* ecInput, size_t programCounter)
 {
     ASSERT(state.context()->m_sandBoxStack.size());
@@ -30,7 +30,7 @@ namespace Escargot {
 class Context;
 class ByteCodeBlock;
 class LexicalEnvironment;
-struct GetObjectInlineCache;
+class GetObjectPreComputedCase;
 struct SetObjectInlineCache;
 struct EnumerateObjectData;
 class GetGlobalObject;
@@ -45,6 +45,7 @@ class DeclareFunctionDeclarations;
 class ObjectDefineGetter;
 class ObjectDefineSetter;
 class GlobalObject;
+class FunctionEnvironmentRecord;
 
 class ByteCodeInterpreter {
 public:
@@ -65,8 +66,8 @@ public:
     static bool abstractRelationalComparisonOrEqualSlowCase(ExecutionState& state, const Value& left, const Value& right, bool leftFirst);
     static bool abstractRelationalComparisonOrEqual(ExecutionState& state, const Value& left, const Value& right, bool leftFirst);
 
-    static Value getObjectPrecomputedCaseOperation(ExecutionState& state, Object* obj, const Value& receiver, const PropertyName& name, GetObjectInlineCache& inlineCache, ByteCodeBlock* block);
-    static Value getObjectPrecomputedCaseOperationCacheMiss(ExecutionState& state, Object* obj, const Value& receiver, const PropertyName& name, GetObjectInlineCache& inlineCache, ByteCodeBlock* block);
+    static Value getObjectPrecomputedCaseOperation(ExecutionState& state, Object* obj, const Value& receiver, GetObjectPreComputedCase* code, ByteCodeBlock* block);
+    static Value getObjectPrecomputedCaseOperationCacheMiss(ExecutionState& state, Object* obj, const Value& receiver, GetObjectPreComputedCase* code, ByteCodeBlock* block);
     static void setObjectPreComputedCaseOperation(ExecutionState& state, const Value& willBeObject, const PropertyName& name, const Value& value, SetObjectInlineCache& inlineCache, ByteCodeBlock* block);
     static void setObjectPreComputedCaseOperationCacheMiss(ExecutionState& state, Object* obj, const Value& willBeObject, const PropertyName& name, const Value& value, SetObjectInlineCache& inlineCache, ByteCodeBlock* block);
 
@@ -85,6 +86,9 @@ public:
     static bool binaryInOperation(ExecutionState& state, const Value& left, const Value& right);
     static Value callFunctionInWithScope(ExecutionState& state, CallFunctionInWithScope* code, ExecutionContext* ec, LexicalEnvironment* env, Value* argv);
 
+    static FunctionEnvironmentRecord* lazyArgumentsRecord(ExecutionContext* ec, size_t upperIndex);
+    static Value createLazyArgumentsObject(ExecutionState& state, ExecutionContext* ec, size_t upperIndex);
+
     static void declareFunctionDeclarations(ExecutionState& state, DeclareFunctionDeclarations* code, LexicalEnvironment* lexicalEnvironment, Value* stackStorage);
     static void defineObjectGetter(ExecutionState& state, ObjectDefineGetter* code, Value* registerFile);
     static void defineObjectSetter(ExecutionState& state, ObjectDefineSetter* code, Value* registerFile);
@@ -31,15 +31,12 @@ void* CodeBlock::operator new(size_t size)
 #ifdef GC_DEBUG
     return CustomAllocator<CodeBlock>().allocate(1);
 #else
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(CodeBlock)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(CodeBlock, m_context));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(CodeBlock, m_byteCodeBlock));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(CodeBlock));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(CodeBlock));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 #endif
 }
@@ -49,9 +46,7 @@ void* InterpretedCodeBlock::operator new(size_t size)
 #ifdef GC_DEBUG
     return CustomAllocator<InterpretedCodeBlock>().allocate(1);
 #else
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(InterpretedCodeBlock)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(InterpretedCodeBlock, m_context));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(InterpretedCodeBlock, m_script));
@@ -63,9 +58,8 @@ void* InterpretedCodeBlock::operator new(size_t size)
 #ifndef NDEBUG
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(InterpretedCodeBlock, m_scopeContext));
 #endif
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(InterpretedCodeBlock));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(InterpretedCodeBlock));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 #endif
 }
@@ -86,6 +80,7 @@ CodeBlock::CodeBlock(Context* ctx, const NativeFunctionInfo& info)
     m_inCatch = false;
     m_inWith = false;
     m_usesArgumentsObject = false;
+    m_hasLazyArgumentsObject = false;
     m_canUseIndexedVariableStorage = true;
     m_canAllocateEnvironmentOnStack = true;
     m_needsComplexParameterCopy = false;
@@ -120,6 +115,7 @@ CodeBlock::CodeBlock(Context* ctx, AtomicString name, size_t argc, bool isStrict
     m_inCatch = false;
     m_inWith = false;
     m_usesArgumentsObject = false;
+    m_hasLazyArgumentsObject = false;
     m_canUseIndexedVariableStorage = true;
     m_canAllocateEnvironmentOnStack = true;
     m_needsComplexParameterCopy = false;
@@ -174,6 +170,7 @@ CodeBlock::CodeBlock(ExecutionState& state, FunctionObject* targetFunction, Valu
     m_inCatch = false;
     m_inWith = false;
     m_usesArgumentsObject = false;
+    m_hasLazyArgumentsObject = false;
     m_canUseIndexedVariableStorage = true;
     m_canAllocateEnvironmentOnStack = true;
     m_needsComplexParameterCopy = false;
@@ -265,6 +262,7 @@ InterpretedCodeBlock::InterpretedCodeBlock(Context* ctx, Script* script, StringV
     }
 
     m_usesArgumentsObject = false;
+    m_hasLazyArgumentsObject = false;
     m_canUseIndexedVariableStorage = false;
     m_canAllocateEnvironmentOnStack = false;
     m_needsComplexParameterCopy = false;
@@ -351,6 +349,7 @@ InterpretedCodeBlock::InterpretedCodeBlock(Context* ctx, Script* script, StringV
     }
 
     m_usesArgumentsObject = false;
+    m_hasLazyArgumentsObject = false;
 
     if (initFlags & CodeBlockInitFlag::CodeBlockIsFunctionDeclaration) {
         m_isFunctionDeclaration = true;
@@ -449,6 +448,7 @@ void InterpretedCodeBlock::captureArguments()
         info.m_name = arguments;
         info.m_needToAllocateOnStack = true;
         info.m_isMutable = true;
+        info.m_isExplicitlyDeclaredOrParameterName = false;
         m_identifierInfos.pushBack(info);
     }
     if (m_parameterCount) {
@@ -625,6 +625,17 @@ void InterpretedCodeBlock::computeVariables()
                 m_parametersInfomation[i].m_index = computedNameIndex[computedIndex].second;
             }
         }
+
+        // arguments object can be created lazily when nobody can see it before we create it.
+        // it should not be captured by inner functions or declared by user,
+        // and it should not be mapped to parameters
+        if (m_usesArgumentsObject && !hasWith() && (isStrict() || !m_parametersInfomation.size())) {
+            AtomicString arguments = m_context->staticStrings().arguments;
+            size_t idx = findName(arguments);
+            if (idx != SIZE_MAX && arguments != m_functionName && m_identifierInfos[idx].m_needToAllocateOnStack && !m_identifierInfos[idx].m_isExplicitlyDeclaredOrParameterName) {
+                m_hasLazyArgumentsObject = true;
+            }
+        }
     } else {
         m_needsComplexParameterCopy = true;
 
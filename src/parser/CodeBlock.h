@@ -223,6 +223,13 @@ public:
         return m_usesArgumentsObject;
     }
 
+    // arguments object is created only when it is really needed
+    // arguments.length, arguments[i] are read from argc, argv of the call before that
+    bool hasLazyArgumentsObject() const
+    {
+        return m_hasLazyArgumentsObject;
+    }
+
     AtomicString functionName() const
     {
         return m_functionName;
@@ -316,6 +323,7 @@ protected:
     bool m_inCatch : 1;
     bool m_inWith : 1;
     bool m_usesArgumentsObject : 1;
+    bool m_hasLazyArgumentsObject : 1;
     bool m_isFunctionExpression : 1;
     bool m_isFunctionDeclaration : 1;
     bool m_isFunctionDeclarationWithSpecialBinding : 1;
@@ -26,11 +26,13 @@
 #include "parser/ScriptParser.h"
 #include "parser/ast/AST.h"
 #include "parser/CodeBlock.h"
+#include "util/Util.h"
 
 namespace Escargot {
 
 ScriptParser::ScriptParser(Context* c)
     : m_context(c)
+    , m_collectStatistics(getenv("DUMP_PARSER_STATISTICS") && strlen(getenv("DUMP_PARSER_STATISTICS")))
 {
 }
 
@@ -146,6 +148,9 @@ InterpretedCodeBlock* ScriptParser::generateCodeBlockTreeFromASTWalker(Context*
         }
     }
 
+    if (UNLIKELY(m_collectStatistics)) {
+        m_statistics.m_preParsedFunctionCount += scopeCtx->m_childScopes.size();
+    }
     codeBlock->m_childBlocks.resizeWithUninitializedValues(scopeCtx->m_childScopes.size());
     for (size_t i = 0; i < scopeCtx->m_childScopes.size(); i++) {
         codeBlock->m_childBlocks[i] = generateCodeBlockTreeFromASTWalker(ctx, source, script, scopeCtx->m_childScopes[i], codeBlock);
@@ -177,6 +182,17 @@ void ScriptParser::generateCodeBlockTreeFromASTWalkerPostProcess(InterpretedCode
 }
 
 ScriptParser::ScriptParserResult ScriptParser::parse(StringView scriptSource, String* fileName, InterpretedCodeBlock* parentCodeBlock, bool strictFromOutside, bool isEvalCodeInFunction, size_t stackSizeRemain)
+{
+    m_context->vmInstance()->m_parsedSourceCodes.push_back(scriptSource.string());
+    return parseWithoutRegisteringSource(scriptSource, fileName, parentCodeBlock, strictFromOutside, isEvalCodeInFunction, stackSizeRemain);
+}
+
+BackgroundParseTask* ScriptParser::createBackgroundParseTask(String* script, String* fileName)
+{
+    return new BackgroundParseTask(m_context, script, fileName);
+}
+
+ScriptParser::ScriptParserResult ScriptParser::parseWithoutRegisteringSource(StringView scriptSource, String* fileName, InterpretedCodeBlock* parentCodeBlock, bool strictFromOutside, bool isEvalCodeInFunction, size_t stackSizeRemain)
 {
     Script* script = nullptr;
     ScriptParseError* error = nullptr;
@@ -184,8 +200,14 @@ ScriptParser::ScriptParserResult ScriptParser::parse(StringView scriptSource, St
     GC_disable();
 
     try {
-        m_context->vmInstance()->m_parsedSourceCodes.push_back(scriptSource.string());
+        uint64_t parseStart = UNLIKELY(m_collectStatistics) ? longTickCount() : 0;
         RefPtr<ProgramNode> program = esprima::parseProgram(m_context, scriptSource, strictFromOutside, stackSizeRemain);
+        uint64_t parseEnd = 0;
+        if (UNLIKELY(m_collectStatistics)) {
+            parseEnd = longTickCount();
+            m_statistics.m_programParseCount++;
+            m_statistics.m_programParseTime += parseEnd - parseStart;
+        }
 
         script = new Script(fileName, new StringView(scriptSource));
         InterpretedCodeBlock* topCodeBlock;
@@ -204,6 +226,9 @@ ScriptParser::ScriptParserResult ScriptParser::parse(StringView scriptSource, St
         topCodeBlock->m_isEvalCodeInFunction = isEvalCodeInFunction;
 
         generateCodeBlockTreeFromASTWalkerPostProcess(topCodeBlock);
+        if (UNLIKELY(m_collectStatistics)) {
+            m_statistics.m_codeBlockTreeGenerationTime += longTickCount() - parseEnd;
+        }
 
         program->ref();
         topCodeBlock->m_cachedASTNode = program.get();
@@ -277,11 +302,62 @@ ScriptParser::ScriptParserResult ScriptParser::parse(StringView scriptSource, St
 std::tuple<RefPtr<Node>, ASTScopeContext*> ScriptParser::parseFunction(InterpretedCodeBlock* codeBlock, size_t stackSizeRemain, ExecutionState* state)
 {
     try {
+        if (LIKELY(!m_collectStatistics)) {
+            return esprima::parseSingleFunction(m_context, codeBlock, stackSizeRemain);
+        }
+        uint64_t parseStart = longTickCount();
         std::tuple<RefPtr<Node>, ASTScopeContext*> body = esprima::parseSingleFunction(m_context, codeBlock, stackSizeRemain);
+        m_statistics.m_functionParseCount++;
+        m_statistics.m_functionParseTime += longTickCount() - parseStart;
         return body;
     } catch (esprima::Error& orgError) {
         ErrorObject::throwBuiltinError(*state, ErrorObject::SyntaxError, orgError.message->toUTF8StringData().data());
         RELEASE_ASSERT_NOT_REACHED();
     }
 }
+
+void ScriptParser::dumpStatistics()
+{
+    ESCARGOT_LOG_INFO("Parser statistics\n");
+    ESCARGOT_LOG_INFO("  program parse: %d times, %f ms\n", (int)m_statistics.m_programParseCount, m_statistics.m_programParseTime / 1000.f);
+    ESCARGOT_LOG_INFO("  code block tree generation: %f ms\n", m_statistics.m_codeBlockTreeGenerationTime / 1000.f);
+    ESCARGOT_LOG_INFO("  pre-parsed functions: %d\n", (int)m_statistics.m_preParsedFunctionCount);
+    ESCARGOT_LOG_INFO("  function parse: %d times, %f ms\n", (int)m_statistics.m_functionParseCount, m_statistics.m_functionParseTime / 1000.f);
+}
+
+BackgroundParseTask::BackgroundParseTask(Context* c, String* source, String* fileName)
+    : m_context(c)
+    , m_parser(c)
+    , m_source(source)
+    , m_fileName(fileName)
+    , m_result(nullptr, nullptr)
+    , m_hasRun(false)
+{
+#if defined(ESCARGOT_THREADING)
+    c->atomicStringMap()->enterBackgroundParse();
+#endif
+}
+
+BackgroundParseTask::~BackgroundParseTask()
+{
+#if defined(ESCARGOT_THREADING)
+    m_context->atomicStringMap()->leaveBackgroundParse();
+#endif
+}
+
+void BackgroundParseTask::run()
+{
+    ASSERT(!m_hasRun);
+    m_result = m_parser.parseWithoutRegisteringSource(StringView(m_source, 0, m_source->length()), m_fileName, nullptr, false, false, SIZE_MAX);
+    m_hasRun = true;
+}
+
+ScriptParser::ScriptParserResult BackgroundParseTask::finalize()
+{
+    if (!m_hasRun) {
+        run();
+    }
+    m_context->vmInstance()->parsedSourceCodes().push_back(m_source);
+    return m_result;
+}
 }
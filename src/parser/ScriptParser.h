@@ -32,6 +32,7 @@ class InterpretedCodeBlock;
 class Context;
 class ProgramNode;
 class Node;
+class BackgroundParseTask;
 typedef Vector<void*, GCUtil::gc_malloc_ignore_off_page_allocator<void*>, 150> LiteralValueRooterVector;
 
 class ScriptParser : public gc {
@@ -58,19 +59,89 @@ public:
         ScriptParseError* m_error;
     };
 
+    // per-phase counters of parser (times are in microseconds)
+    // parsing a program builds AST for top-level code only.
+    // function bodies are pre-parsed to collect scope information,
+    // and parsed fully by parseFunction when they are compiled
+    struct ParserStatistics {
+        ParserStatistics()
+            : m_programParseCount(0)
+            , m_programParseTime(0)
+            , m_codeBlockTreeGenerationTime(0)
+            , m_preParsedFunctionCount(0)
+            , m_functionParseCount(0)
+            , m_functionParseTime(0)
+        {
+        }
+
+        size_t m_programParseCount;
+        uint64_t m_programParseTime;
+        uint64_t m_codeBlockTreeGenerationTime;
+        size_t m_preParsedFunctionCount;
+        size_t m_functionParseCount;
+        uint64_t m_functionParseTime;
+    };
+
     ScriptParserResult parse(String* script, String* fileName = String::emptyString, bool strictFromOutside = false, bool isEvalCodeInFunction = false, size_t stackSizeRemain = SIZE_MAX)
     {
         return parse(StringView(script, 0, script->length()), fileName, nullptr, strictFromOutside, isEvalCodeInFunction, stackSizeRemain);
     }
     ScriptParserResult parse(StringView script, String* fileName = String::emptyString, InterpretedCodeBlock* parentCodeBlock = nullptr, bool strictFromOutside = false, bool isEvalCodeInFunction = false, size_t stackSizeRemain = SIZE_MAX);
+    // see BackgroundParseTask
+    BackgroundParseTask* createBackgroundParseTask(String* script, String* fileName);
     std::tuple<RefPtr<Node>, ASTScopeContext*> parseFunction(InterpretedCodeBlock* codeBlock, size_t stackSizeRemain, ExecutionState* state = nullptr);
 
+    const ParserStatistics& statistics()
+    {
+        return m_statistics;
+    }
+
+    void dumpStatistics();
+
 private:
+    friend class BackgroundParseTask;
+    // does not touch VMInstance, so BackgroundParseTask can call it from a worker thread
+    ScriptParserResult parseWithoutRegisteringSource(StringView script, String* fileName, InterpretedCodeBlock* parentCodeBlock, bool strictFromOutside, bool isEvalCodeInFunction, size_t stackSizeRemain);
     InterpretedCodeBlock* generateCodeBlockTreeFromAST(Context* ctx, StringView source, Script* script, ProgramNode* program);
     InterpretedCodeBlock* generateCodeBlockTreeFromASTWalker(Context* ctx, StringView source, Script* script, ASTScopeContext* scopeCtx, InterpretedCodeBlock* parentCodeBlock);
     void generateCodeBlockTreeFromASTWalkerPostProcess(InterpretedCodeBlock* cb);
 
     Context* m_context;
+    // statistics are collected only when DUMP_PARSER_STATISTICS is set
+    bool m_collectStatistics;
+    ParserStatistics m_statistics;
+};
+
+// parses a script on a worker thread and hands the result to the thread owns the Context.
+// it is created and finalized on the owning thread, and run on any thread registered to GC.
+// it has own ScriptParser, so statistics of the context parser are not touched by workers
+class BackgroundParseTask {
+public:
+    BackgroundParseTask(Context* c, String* source, String* fileName);
+    ~BackgroundParseTask();
+
+    void run();
+    // registers source to VMInstance and returns the result of run
+    ScriptParser::ScriptParserResult finalize();
+
+    // the task is usually held by memory of embedder which GC does not scan
+    inline void* operator new(size_t size)
+    {
+        return GC_MALLOC_UNCOLLECTABLE(size);
+    }
+
+    inline void operator delete(void* obj)
+    {
+        GC_FREE(obj);
+    }
+
+private:
+    Context* m_context;
+    ScriptParser m_parser;
+    String* m_source;
+    String* m_fileName;
+    ScriptParser::ScriptParserResult m_result;
+    bool m_hasRun;
 };
 }
 
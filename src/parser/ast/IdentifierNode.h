@@ -109,7 +109,9 @@ public:
                 }
 
                 if (info.m_isStackAllocated) {
-                    if (context->m_canSkipCopyToRegister) {
+                    if (UNLIKELY(isLazyArgumentsObject(context))) {
+                        codeBlock->pushCode(LoadArgumentsObject(ByteCodeLOC(m_loc.index), REGULAR_REGISTER_LIMIT + info.m_index, dstRegister, context->m_catchScopeCount), context, this);
+                    } else if (context->m_canSkipCopyToRegister) {
                         if (dstRegister != (REGULAR_REGISTER_LIMIT + info.m_index)) {
                             codeBlock->pushCode(Move(ByteCodeLOC(m_loc.index), REGULAR_REGISTER_LIMIT + info.m_index, dstRegister), context, this);
                         }
@@ -147,7 +149,7 @@ public:
                     return std::make_pair(false, std::numeric_limits<ByteCodeRegisterIndex>::max());
                 }
 
-                if (info.m_isStackAllocated && info.m_isMutable) {
+                if (info.m_isStackAllocated && info.m_isMutable && !isLazyArgumentsObject(context)) {
                     if (context->m_canSkipCopyToRegister)
                         return std::make_pair(true, REGULAR_REGISTER_LIMIT + info.m_index);
                     else
@@ -161,6 +163,17 @@ public:
         }
     }
 
+    // reading arguments of function which has lazy arguments object should create the object
+    // so register of it should not be used directly
+    bool isLazyArgumentsObject(ByteCodeGenerateContext* context)
+    {
+        InterpretedCodeBlock* cb = context->m_codeBlock->asInterpretedCodeBlock();
+        if (!cb->hasLazyArgumentsObject() || m_name != cb->context()->staticStrings().arguments) {
+            return false;
+        }
+        return !context->m_isWithScope && !(context->m_catchScopeCount && m_name == context->m_lastCatchVariableName);
+    }
+
     virtual ByteCodeRegisterIndex getRegister(ByteCodeBlock* codeBlock, ByteCodeGenerateContext* context)
     {
         auto ret = isAllocatedOnStack(context);
@@ -67,6 +67,10 @@ public:
         bool prevHead = context->m_isHeadOfMemberExpression;
         context->m_isHeadOfMemberExpression = false;
 
+        if (!(context->m_inCallingExpressionScope && prevHead) && generateLazyArgumentsAccessByteCode(codeBlock, context, dstIndex)) {
+            return;
+        }
+
         bool isSimple = true;
 
         if (!m_object->isIdentifier() || (!m_property->isLiteral() && !m_property->isIdentifier())) {
@@ -166,6 +170,35 @@ public:
         }
     }
 
+    // arguments.length and arguments[i] can be read without creating arguments object
+    bool generateLazyArgumentsAccessByteCode(ByteCodeBlock* codeBlock, ByteCodeGenerateContext* context, ByteCodeRegisterIndex dstIndex)
+    {
+        if (!m_object->isIdentifier() || !m_object->asIdentifier()->isLazyArgumentsObject(context)) {
+            return false;
+        }
+
+        InterpretedCodeBlock* cb = context->m_codeBlock->asInterpretedCodeBlock();
+        AtomicString arguments = cb->context()->staticStrings().arguments;
+        ByteCodeRegisterIndex argumentsIndex = REGULAR_REGISTER_LIMIT + cb->indexedIdentifierInfo(arguments).m_index;
+        if (isPreComputedCase()) {
+            if (propertyName() != cb->context()->staticStrings().length) {
+                return false;
+            }
+            codeBlock->pushCode(GetArgumentsLength(ByteCodeLOC(m_loc.index), argumentsIndex, dstIndex, context->m_catchScopeCount), context, this);
+            return true;
+        }
+
+        // evaluating property should not be able to change arguments before we read it
+        if (!cb->isStrict() && !m_property->isLiteral() && !m_property->isIdentifier()) {
+            return false;
+        }
+        size_t propertyIndex = m_property->getRegister(codeBlock, context);
+        m_property->generateExpressionByteCode(codeBlock, context, propertyIndex);
+        codeBlock->pushCode(GetArgumentsElement(ByteCodeLOC(m_loc.index), argumentsIndex, propertyIndex, dstIndex, context->m_catchScopeCount), context, this);
+        context->giveUpRegister();
+        return true;
+    }
+
     virtual void iterateChildrenIdentifier(const std::function<void(AtomicString name, bool isAssignment)>& fn)
     {
         m_object->iterateChildrenIdentifier(fn);
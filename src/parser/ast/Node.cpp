@@ -56,18 +56,15 @@ void Node::generateReferenceResolvedAddressByteCode(ByteCodeBlock* codeBlock, By
 
 void* ASTScopeContext::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(ASTScopeContext)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ASTScopeContext, m_names));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ASTScopeContext, m_usingNames));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ASTScopeContext, m_parameters));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ASTScopeContext, m_childScopes));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ASTScopeContext, m_numeralLiteralData));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ASTScopeContext));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ASTScopeContext));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 }
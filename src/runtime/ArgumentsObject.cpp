@@ -50,9 +50,7 @@ static void ArgumentsObjectNativeSetter(ExecutionState& state, Object* self, con
 
 void* ArgumentsObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(ArgumentsObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArgumentsObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArgumentsObject, m_prototype));
@@ -60,16 +58,18 @@ void* ArgumentsObject::operator new(size_t size)
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArgumentsObject, m_targetRecord));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArgumentsObject, m_codeBlock));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArgumentsObject, m_argumentPropertyInfo));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ArgumentsObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ArgumentsObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
 ArgumentsObject::ArgumentsObject(ExecutionState& state, FunctionEnvironmentRecord* record, ExecutionContext* ec)
     : Object(state, ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER + 3, true)
 {
-    g_argumentsObjectTag = *((size_t*)this);
+    static std::once_flag argumentsObjectTagInitFlag;
+    std::call_once(argumentsObjectTagInitFlag, [this]() {
+        g_argumentsObjectTag = *((size_t*)this);
+    });
 
     InterpretedCodeBlock* blk = record->functionObject()->codeBlock()->asInterpretedCodeBlock();
     bool isStrict = blk->isStrict();
@@ -163,17 +163,27 @@ ArgumentsObject::ArgumentsObject(ExecutionState& state, FunctionEnvironmentRecor
     }
 }
 
-ObjectGetResult ArgumentsObject::getOwnProperty(ExecutionState& state, const ObjectPropertyName& P) ESCARGOT_OBJECT_SUBCLASS_MUST_REDEFINE
+Value ArgumentsObject::argumentValue(ExecutionState& state, uint64_t idx)
 {
-    uint64_t idx = P.tryToUseAsIndex();
-    if (LIKELY(idx != Value::InvalidIndexValue) && idx < m_argumentPropertyInfo.size()) {
+    if (LIKELY(idx < m_argumentPropertyInfo.size())) {
         Value val = m_argumentPropertyInfo[idx].first;
-        if (!val.isEmpty()) {
+        if (LIKELY(!val.isEmpty())) {
             if (m_argumentPropertyInfo[idx].second.string()->length()) {
-                return ObjectGetResult(ArgumentsObjectNativeGetter(state, this, m_targetRecord, m_codeBlock, m_argumentPropertyInfo[idx].second), true, true, true);
-            } else {
-                return ObjectGetResult(val, true, true, true);
+                return ArgumentsObjectNativeGetter(state, this, m_targetRecord, m_codeBlock, m_argumentPropertyInfo[idx].second);
             }
+            return val;
+        }
+    }
+    return Value(Value::EmptyValue);
+}
+
+ObjectGetResult ArgumentsObject::getOwnProperty(ExecutionState& state, const ObjectPropertyName& P) ESCARGOT_OBJECT_SUBCLASS_MUST_REDEFINE
+{
+    uint64_t idx = P.tryToUseAsIndex();
+    if (LIKELY(idx != Value::InvalidIndexValue)) {
+        Value val = argumentValue(state, idx);
+        if (!val.isEmpty()) {
+            return ObjectGetResult(val, true, true, true);
         }
     }
     return Object::getOwnProperty(state, P);
@@ -267,19 +277,32 @@ void ArgumentsObject::enumeration(ExecutionState& state, bool (*callback)(Execut
 ObjectGetResult ArgumentsObject::getIndexedProperty(ExecutionState& state, const Value& property)
 {
     Value::ValueIndex idx = property.tryToUseAsIndex(state);
-    if (LIKELY(idx != Value::InvalidIndexValue) && idx < m_argumentPropertyInfo.size()) {
-        Value val = m_argumentPropertyInfo[idx].first;
+    if (LIKELY(idx != Value::InvalidIndexValue)) {
+        Value val = argumentValue(state, idx);
         if (!val.isEmpty()) {
-            if (m_argumentPropertyInfo[idx].second.string()->length()) {
-                return ObjectGetResult(ArgumentsObjectNativeGetter(state, this, m_targetRecord, m_codeBlock, m_argumentPropertyInfo[idx].second), true, true, true);
-            } else {
-                return ObjectGetResult(val, true, true, true);
-            }
+            return ObjectGetResult(val, true, true, true);
         }
     }
     return get(state, ObjectPropertyName(state, property));
 }
 
+void ArgumentsObject::getIndexedProperties(ExecutionState& state, size_t count, Value* result)
+{
+    for (size_t i = 0; i < count; i++) {
+        Value val = argumentValue(state, i);
+        if (LIKELY(!val.isEmpty())) {
+            result[i] = val;
+            continue;
+        }
+        auto re = get(state, ObjectPropertyName(state, Value(i)));
+        if (re.hasValue()) {
+            result[i] = re.value(state, this);
+        } else {
+            result[i] = Value();
+        }
+    }
+}
+
 bool ArgumentsObject::setIndexedProperty(ExecutionState& state, const Value& property, const Value& value)
 {
     Value::ValueIndex idx = property.tryToUseAsIndex(state);
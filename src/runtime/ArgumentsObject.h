@@ -38,8 +38,13 @@ public:
     virtual bool defineOwnProperty(ExecutionState& state, const ObjectPropertyName& P, const ObjectPropertyDescriptor& desc) ESCARGOT_OBJECT_SUBCLASS_MUST_REDEFINE;
     virtual bool deleteOwnProperty(ExecutionState& state, const ObjectPropertyName& P) ESCARGOT_OBJECT_SUBCLASS_MUST_REDEFINE;
     virtual void enumeration(ExecutionState& state, bool (*callback)(ExecutionState& state, Object* self, const ObjectPropertyName&, const ObjectStructurePropertyDescriptor& desc, void* data), void* data, bool shouldSkipSymbolKey = true);
+    virtual bool canUseEnumerationCache()
+    {
+        return false;
+    }
     virtual ObjectGetResult getIndexedProperty(ExecutionState& state, const Value& property);
     virtual bool setIndexedProperty(ExecutionState& state, const Value& property, const Value& value);
+    virtual void getIndexedProperties(ExecutionState& state, size_t count, Value* result);
     // http://www.ecma-international.org/ecma-262/5.1/#sec-8.6.2
     virtual const char* internalClassProperty()
     {
@@ -50,6 +55,9 @@ public:
     void* operator new[](size_t size) = delete;
 
 protected:
+    // value of own argument slot at idx which follows mapped parameter if any. empty if there is no slot
+    Value argumentValue(ExecutionState& state, uint64_t idx);
+
     FunctionEnvironmentRecord* m_targetRecord;
     InterpretedCodeBlock* m_codeBlock;
     TightVector<std::pair<SmallValue, AtomicString>, GCUtil::gc_malloc_ignore_off_page_allocator<std::pair<SmallValue, AtomicString>>> m_argumentPropertyInfo;
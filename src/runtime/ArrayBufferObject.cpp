@@ -92,16 +92,13 @@ bool ArrayBufferObject::cloneBuffer(ArrayBufferObject* srcBuffer, size_t srcByte
 
 void* ArrayBufferObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(ArrayBufferObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayBufferObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayBufferObject, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayBufferObject, m_values));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ArrayBufferObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ArrayBufferObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 }
@@ -30,6 +30,7 @@ size_t g_arrayObjectTag;
 
 ArrayObject::ArrayObject(ExecutionState& state)
     : Object(state, ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER + 1, true)
+    , m_elementKind(SMIElements)
 {
     m_structure = state.context()->defaultStructureForArrayObject();
     m_values[ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER] = Value(0);
@@ -171,7 +172,7 @@ bool ArrayObject::deleteOwnProperty(ExecutionState& state, const ObjectPropertyN
         if (LIKELY(idx != Value::InvalidArrayIndexValue)) {
             uint64_t len = getArrayLength(state);
             if (idx < len) {
-                m_fastModeData[idx] = Value(Value::EmptyValue);
+                setFastModeElement(idx, Value(Value::EmptyValue));
                 ensureObjectRareData()->m_shouldUpdateEnumerateObjectData = true;
                 return true;
             }
@@ -186,7 +187,7 @@ void ArrayObject::enumeration(ExecutionState& state, bool (*callback)(ExecutionS
         size_t len = getArrayLength(state);
         for (size_t i = 0; i < len; i++) {
             ASSERT(isFastModeArray());
-            if (m_fastModeData[i].isEmpty())
+            if (getFastModeElement(i).isEmpty())
                 continue;
             if (!callback(state, this, ObjectPropertyName(state, Value(i)), ObjectStructurePropertyDescriptor::createDataDescriptor(ObjectStructurePropertyDescriptor::AllPresent), data)) {
                 return;
@@ -204,7 +205,7 @@ void ArrayObject::sort(ExecutionState& state, const std::function<bool(const Val
             Value* tempBuffer = (Value*)GC_MALLOC_IGNORE_OFF_PAGE(sizeof(Value) * orgLength);
 
             for (size_t i = 0; i < orgLength; i++) {
-                tempBuffer[i] = m_fastModeData[i];
+                tempBuffer[i] = getFastModeElement(i);
             }
 
             if (orgLength) {
@@ -223,7 +224,7 @@ void ArrayObject::sort(ExecutionState& state, const std::function<bool(const Val
 
             if (isFastModeArray()) {
                 for (size_t i = 0; i < orgLength; i++) {
-                    m_fastModeData[i] = tempBuffer[i];
+                    setFastModeElement(i, tempBuffer[i]);
                 }
             }
             GC_FREE(tempBuffer);
@@ -256,12 +257,14 @@ void ArrayObject::convertIntoNonFastMode(ExecutionState& state)
 
     auto length = getArrayLength(state);
     for (size_t i = 0; i < length; i++) {
-        if (!m_fastModeData[i].isEmpty()) {
-            defineOwnPropertyThrowsExceptionWhenStrictMode(state, ObjectPropertyName(state, Value(i)), ObjectPropertyDescriptor(m_fastModeData[i], ObjectPropertyDescriptor::AllPresent));
+        Value v = getFastModeElement(i);
+        if (!v.isEmpty()) {
+            defineOwnPropertyThrowsExceptionWhenStrictMode(state, ObjectPropertyName(state, Value(i)), ObjectPropertyDescriptor(v, ObjectPropertyDescriptor::AllPresent));
         }
     }
 
     m_fastModeData.clear();
+    m_elementKind = GenericElements;
 }
 
 bool ArrayObject::setArrayLength(ExecutionState& state, const uint64_t& newLength)
@@ -277,7 +280,15 @@ bool ArrayObject::setArrayLength(ExecutionState& state, const uint64_t& newLengt
         auto oldSize = getArrayLength(state);
         auto oldLenDesc = structure()->readProperty(state, (size_t)0);
         m_values[ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER] = Value(newLength);
+#ifdef ESCARGOT_64
+        if (m_elementKind == DoubleElements) {
+            m_fastModeData.resize(oldSize, newLength, SmallValue::fromPayload((void*)holeInDoubleElements));
+        } else {
+            m_fastModeData.resize(oldSize, newLength, Value(Value::EmptyValue));
+        }
+#else
         m_fastModeData.resize(oldSize, newLength, Value(Value::EmptyValue));
+#endif
 
         if (UNLIKELY(!oldLenDesc.m_descriptor.isWritable())) {
             convertIntoNonFastMode(state);
@@ -323,7 +334,7 @@ ObjectGetResult ArrayObject::getFastModeValue(ExecutionState& state, const Objec
     if (LIKELY(isFastModeArray())) {
         uint64_t idx = P.tryToUseAsArrayIndex();
         if (LIKELY(idx != Value::InvalidArrayIndexValue) && LIKELY(idx < getArrayLength(state))) {
-            Value v = m_fastModeData[idx];
+            Value v = getFastModeElement(idx);
             if (LIKELY(!v.isEmpty())) {
                 return ObjectGetResult(v, true, true, true);
             }
@@ -339,7 +350,7 @@ bool ArrayObject::setFastModeValue(ExecutionState& state, const ObjectPropertyNa
         uint64_t idx = P.tryToUseAsArrayIndex();
         if (LIKELY(idx != Value::InvalidArrayIndexValue)) {
             uint32_t len = getArrayLength(state);
-            if (len > idx && !m_fastModeData[idx].isEmpty()) {
+            if (len > idx && !getFastModeElement(idx).isEmpty()) {
                 // Non-empty slot of fast-mode array always has {writable:true, enumerable:true, configurable:true}.
                 // So, when new desciptor is not present, keep {w:true, e:true, c:true}
                 if (UNLIKELY(!(desc.isValuePresentAlone() || desc.isDataWritableEnumerableConfigurable()))) {
@@ -366,7 +377,7 @@ bool ArrayObject::setFastModeValue(ExecutionState& state, const ObjectPropertyNa
                     return false;
                 }
             }
-            m_fastModeData[idx] = desc.value();
+            setFastModeElement(idx, desc.value());
             return true;
         }
     }
@@ -378,7 +389,7 @@ ObjectGetResult ArrayObject::getIndexedProperty(ExecutionState& state, const Val
     if (LIKELY(isFastModeArray())) {
         uint32_t idx = property.tryToUseAsArrayIndex(state);
         if (LIKELY(idx != Value::InvalidArrayIndexValue) && LIKELY(idx < getArrayLength(state))) {
-            Value v = m_fastModeData[idx];
+            Value v = getFastModeElement(idx);
             if (LIKELY(!v.isEmpty())) {
                 return ObjectGetResult(v, true, true, true);
             }
@@ -402,13 +413,103 @@ bool ArrayObject::setIndexedProperty(ExecutionState& state, const Value& propert
                     return set(state, ObjectPropertyName(state, property), value, this);
                 }
             }
-            m_fastModeData[idx] = value;
+            setFastModeElement(idx, value);
             return true;
         }
     }
     return set(state, ObjectPropertyName(state, property), value, this);
 }
 
+void ArrayObject::getIndexedProperties(ExecutionState& state, size_t count, Value* result)
+{
+    size_t i = 0;
+    if (LIKELY(isFastModeArray())) {
+        size_t fastModeCount = std::min(count, (size_t)getArrayLength(state));
+        for (; i < fastModeCount; i++) {
+            Value v = getFastModeElement(i);
+            // holes are read from prototype chain, which can change this array
+            if (UNLIKELY(v.isEmpty())) {
+                break;
+            }
+            result[i] = v;
+        }
+    }
+
+    for (; i < count; i++) {
+        auto re = getIndexedProperty(state, Value(i));
+        if (re.hasValue()) {
+            result[i] = re.value(state, this);
+        } else {
+            result[i] = Value();
+        }
+    }
+}
+
+void ArrayObject::setFastModeElementSlowCase(size_t idx, const Value& value)
+{
+    ASSERT(m_elementKind != GenericElements);
+    if (value.isEmpty()) {
+#ifdef ESCARGOT_64
+        if (m_elementKind == DoubleElements) {
+            fastModeDoubleData()[idx] = bitwise_cast<double>(holeInDoubleElements);
+            return;
+        }
+#endif
+        m_fastModeData[idx] = value;
+        return;
+    }
+
+#ifdef ESCARGOT_64
+    if (value.isNumber()) {
+        if (m_elementKind == SMIElements) {
+            size_t length = Value(m_values[ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER]).asNumber();
+            double* data = fastModeDoubleData();
+            for (size_t i = 0; i < length; i++) {
+                SmallValue v = m_fastModeData[i];
+                if (v.isEmpty()) {
+                    data[i] = bitwise_cast<double>(holeInDoubleElements);
+                } else {
+                    ASSERT(v.isInt32());
+                    data[i] = (int32_t)v.asInt32();
+                }
+            }
+            m_elementKind = DoubleElements;
+        }
+
+        // every NaN is stored as quiet NaN, so no stored value can be mistaken for a hole
+        double d = value.asNumber();
+        if (UNLIKELY(std::isnan(d))) {
+            d = std::numeric_limits<double>::quiet_NaN();
+        }
+        fastModeDoubleData()[idx] = d;
+        return;
+    }
+#endif
+
+    convertElementsIntoGenericKind();
+    m_fastModeData[idx] = value;
+}
+
+void ArrayObject::convertElementsIntoGenericKind()
+{
+#ifdef ESCARGOT_64
+    if (m_elementKind == DoubleElements) {
+        size_t length = Value(m_values[ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER]).asNumber();
+        double* data = fastModeDoubleData();
+        for (size_t i = 0; i < length; i++) {
+            double d = data[i];
+            // slot holds raw double bits here. SmallValue::operator= would read it as a pointer
+            if (bitwise_cast<uint64_t>(d) == holeInDoubleElements) {
+                m_fastModeData[i] = SmallValue(Value(Value::EmptyValue));
+            } else {
+                m_fastModeData[i] = SmallValue(Value(d));
+            }
+        }
+    }
+#endif
+    m_elementKind = GenericElements;
+}
+
 ArrayIteratorObject::ArrayIteratorObject(ExecutionState& state, Object* a, Type type)
     : IteratorObject(state)
     , m_array(a)
@@ -420,17 +521,14 @@ ArrayIteratorObject::ArrayIteratorObject(ExecutionState& state, Object* a, Type
 
 void* ArrayIteratorObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(ArrayIteratorObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayIteratorObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayIteratorObject, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayIteratorObject, m_values));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayIteratorObject, m_array));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ArrayIteratorObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ArrayIteratorObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
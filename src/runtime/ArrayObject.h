@@ -38,6 +38,7 @@ class ArrayObject : public Object {
     friend class Context;
     friend class Object;
     friend class ByteCodeInterpreter;
+    friend class JSONFastStringifier;
     friend Value builtinArrayConstructor(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression);
     friend void initializeCustomAllocators();
     friend int getValidValueInArrayObject(void* ptr, GC_mark_custom_result* arr);
@@ -60,6 +61,10 @@ public:
     }
     virtual bool deleteOwnProperty(ExecutionState& state, const ObjectPropertyName& P) ESCARGOT_OBJECT_SUBCLASS_MUST_REDEFINE override;
     virtual void enumeration(ExecutionState& state, bool (*callback)(ExecutionState& state, Object* self, const ObjectPropertyName&, const ObjectStructurePropertyDescriptor& desc, void* data), void* data, bool shouldSkipSymbolKey = true) ESCARGOT_OBJECT_SUBCLASS_MUST_REDEFINE override;
+    virtual bool canUseEnumerationCache() override
+    {
+        return false;
+    }
     virtual uint64_t length(ExecutionState& state) override
     {
         return getArrayLength(state);
@@ -67,6 +72,7 @@ public:
     virtual void sort(ExecutionState& state, const std::function<bool(const Value& a, const Value& b)>& comp) override;
     virtual ObjectGetResult getIndexedProperty(ExecutionState& state, const Value& property) override;
     virtual bool setIndexedProperty(ExecutionState& state, const Value& property, const Value& value) override;
+    virtual void getIndexedProperties(ExecutionState& state, size_t count, Value* result) override;
 
     // Use custom allocator for Array object (for Badtime)
     void* operator new(size_t size);
@@ -82,6 +88,32 @@ public:
         return "Array";
     }
 
+    // defines [start, start + count) elements at once. getter(i) returns value of (start + i)th element
+    // fast-mode array grows its length once and stores elements without going through defineOwnProperty
+    template <typename Getter>
+    void setElements(ExecutionState& state, size_t start, size_t count, const Getter& getter)
+    {
+        uint64_t end = (uint64_t)start + count;
+        if (LIKELY(isFastModeArray() && end < Value::InvalidArrayIndexValue)) {
+            if (end > getArrayLength(state)) {
+                if (UNLIKELY(!isExtensible(state))) {
+                    ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, errorMessage_DefineProperty_NotExtensible);
+                }
+                setArrayLength(state, end);
+            }
+            if (LIKELY(isFastModeArray())) {
+                for (size_t i = 0; i < count; i++) {
+                    setFastModeElement(start + i, getter(i));
+                }
+                return;
+            }
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value((double)(start + i))), ObjectPropertyDescriptor(getter(i), ObjectPropertyDescriptor::AllPresent));
+        }
+    }
+
 private:
     ALWAYS_INLINE bool isFastModeArray()
     {
@@ -111,7 +143,64 @@ private:
     ObjectGetResult getFastModeValue(ExecutionState& state, const ObjectPropertyName& P);
     bool setFastModeValue(ExecutionState& state, const ObjectPropertyName& P, const ObjectPropertyDescriptor& desc);
 
+    // elements of fast-mode array start as SMIs and move to raw doubles when other number is stored.
+    // any other value moves them to SmallValue elements. these transitions are one-way.
+    // raw double elements share storage of m_fastModeData, so they are only used on 64-bit
+    enum ElementKind : uint8_t {
+        SMIElements,
+        DoubleElements,
+        GenericElements,
+    };
+
+#ifdef ESCARGOT_64
+    static const uint64_t holeInDoubleElements = 0xFFF7FFFFFFFFFFFFULL;
+
+    double* fastModeDoubleData()
+    {
+        return (double*)m_fastModeData.data();
+    }
+#endif
+
+    ALWAYS_INLINE Value getFastModeElement(size_t idx)
+    {
+#ifdef ESCARGOT_64
+        if (UNLIKELY(m_elementKind == DoubleElements)) {
+            double d = fastModeDoubleData()[idx];
+            if (UNLIKELY(bitwise_cast<uint64_t>(d) == holeInDoubleElements)) {
+                return Value(Value::EmptyValue);
+            }
+            return Value(d);
+        }
+#endif
+        return m_fastModeData[idx];
+    }
+
+    ALWAYS_INLINE void setFastModeElement(size_t idx, const Value& value)
+    {
+        if (LIKELY(m_elementKind == GenericElements)) {
+            m_fastModeData[idx] = value;
+            return;
+        }
+
+        if (m_elementKind == SMIElements && value.isInt32() && SmallValueImpl::PlatformSmiTagging::IsValidSmi(value.asInt32())) {
+            m_fastModeData[idx] = value;
+            return;
+        }
+
+#ifdef ESCARGOT_64
+        if (m_elementKind == DoubleElements && value.isNumber() && !std::isnan(value.asNumber())) {
+            fastModeDoubleData()[idx] = value.asNumber();
+            return;
+        }
+#endif
+        setFastModeElementSlowCase(idx, value);
+    }
+
+    void setFastModeElementSlowCase(size_t idx, const Value& value);
+    void convertElementsIntoGenericKind();
+
     VectorWithNoSize<SmallValue, GCUtil::gc_malloc_ignore_off_page_allocator<SmallValue>> m_fastModeData;
+    ElementKind m_elementKind;
 };
 
 class ArrayIteratorObject : public IteratorObject {
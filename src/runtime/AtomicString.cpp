@@ -70,6 +70,7 @@ AtomicString::AtomicString(Context* c, const SourceStringView& sv)
     }
 
     AtomicStringMap* ec = c->atomicStringMap();
+    AtomicStringMapLocker locker(ec);
     SourceStringView& str = const_cast<SourceStringView&>(sv);
     String* name = &str;
     auto iter = ec->find(name);
@@ -94,6 +95,7 @@ AtomicString::AtomicString(Context* c, const StringView& sv)
     }
 
     AtomicStringMap* ec = c->atomicStringMap();
+    AtomicStringMapLocker locker(ec);
     StringView& str = const_cast<StringView&>(sv);
     String* name = &str;
     auto iter = ec->find(name);
@@ -121,6 +123,7 @@ void AtomicString::init(AtomicStringMap* ec, String* name)
         m_string = (String*)(v & ~POINTER_VALUE_STRING_SYMBOL_TAG_IN_DATA);
         return;
     }
+    AtomicStringMapLocker locker(ec);
     auto iter = ec->find(name);
     if (ec->end() == iter) {
         ec->insert(name);
@@ -27,7 +27,62 @@
 
 namespace Escargot {
 
-typedef std::unordered_set<String*, std::hash<String*>, std::equal_to<String*>, GCUtil::gc_malloc_ignore_off_page_allocator<String*> > AtomicStringMap;
+class AtomicStringMap : public std::unordered_set<String*, std::hash<String*>, std::equal_to<String*>, GCUtil::gc_malloc_ignore_off_page_allocator<String*> > {
+#if defined(ESCARGOT_THREADING)
+    friend class AtomicStringMapLocker;
+
+public:
+    AtomicStringMap()
+        : m_backgroundParseCount(0)
+    {
+    }
+
+    // while background parsers of the VMInstance are alive, they intern names from worker threads.
+    // count is changed on the thread owns the VMInstance only, so that thread never misses the lock
+    void enterBackgroundParse()
+    {
+        m_backgroundParseCount++;
+    }
+
+    void leaveBackgroundParse()
+    {
+        ASSERT(m_backgroundParseCount);
+        m_backgroundParseCount--;
+    }
+
+private:
+    std::atomic<size_t> m_backgroundParseCount;
+    std::mutex m_lock;
+#endif
+};
+
+// locks AtomicStringMap only when a background parser may touch it
+class AtomicStringMapLocker {
+public:
+#if defined(ESCARGOT_THREADING)
+    explicit AtomicStringMapLocker(AtomicStringMap* map)
+        : m_map(UNLIKELY(map->m_backgroundParseCount.load()) ? map : nullptr)
+    {
+        if (UNLIKELY(m_map != nullptr)) {
+            m_map->m_lock.lock();
+        }
+    }
+
+    ~AtomicStringMapLocker()
+    {
+        if (UNLIKELY(m_map != nullptr)) {
+            m_map->m_lock.unlock();
+        }
+    }
+
+private:
+    AtomicStringMap* m_map;
+#else
+    explicit AtomicStringMapLocker(AtomicStringMap*)
+    {
+    }
+#endif
+};
 
 class AtomicString : public gc {
     friend class StaticStrings;
@@ -70,8 +70,11 @@ Context::Context(VMInstance* instance)
     m_globalObject = new GlobalObject(stateForInit);
     m_globalObject->installBuiltins(stateForInit);
 
-    auto temp = new ArrayObject(stateForInit);
-    g_arrayObjectTag = *((size_t*)temp);
+    static std::once_flag arrayObjectTagInitFlag;
+    std::call_once(arrayObjectTagInitFlag, [&stateForInit]() {
+        auto temp = new ArrayObject(stateForInit);
+        g_arrayObjectTag = *((size_t*)temp);
+    });
 }
 
 void Context::throwException(ExecutionState& state, const Value& exception)
@@ -23,6 +23,7 @@
 #include "runtime/AtomicString.h"
 #include "runtime/Context.h"
 #include "runtime/GlobalObject.h"
+#include "runtime/RandomGenerator.h"
 #include "runtime/RegExpObject.h"
 #include "runtime/StaticStrings.h"
 #include "runtime/String.h"
@@ -207,6 +208,11 @@ public:
         return m_securityPolicyCheckCallback;
     }
 
+    RandomGenerator& randomGenerator()
+    {
+        return m_randomGenerator;
+    }
+
 private:
     VMInstance* m_instance;
 
@@ -244,6 +250,7 @@ private:
 #if ESCARGOT_ENABLE_PROMISE
     JobQueue* m_jobQueue;
 #endif
+    RandomGenerator m_randomGenerator;
 };
 }
 
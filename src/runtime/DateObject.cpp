@@ -1256,15 +1256,35 @@ String* DateObject::toUTCString(ExecutionState& state, String* functionName)
     }
 }
 
+#ifdef ENABLE_ICU
+// creating icu::DateFormat loads locale data, so it is kept in cache of VMInstance
+static icu::DateFormat* localeDateFormat(ExecutionState& state, bool isTime)
+{
+    VMInstance* vmInstance = state.context()->vmInstance();
+    std::string cacheKey = isTime ? "localetime:" : "localedate:";
+    cacheKey += vmInstance->locale().getName();
+
+    icu::DateFormat* format = (icu::DateFormat*)vmInstance->icuObjectCache().find(cacheKey);
+    if (!format) {
+        if (isTime) {
+            format = icu::DateFormat::createTimeInstance(icu::DateFormat::MEDIUM, vmInstance->locale());
+        } else {
+            format = icu::DateFormat::createDateInstance(icu::DateFormat::MEDIUM, vmInstance->locale());
+        }
+        vmInstance->icuObjectCache().insert(cacheKey, format, [](void* object) {
+            delete (icu::DateFormat*)object;
+        });
+    }
+    return format;
+}
+#endif
+
 String* DateObject::toLocaleDateString(ExecutionState& state)
 {
     if (IS_VALID_TIME(m_primitiveValue)) {
 #ifdef ENABLE_ICU
         icu::UnicodeString myString;
-        icu::DateFormat* df = icu::DateFormat::createDateInstance(icu::DateFormat::MEDIUM, state.context()->vmInstance()->locale());
-        df->format(primitiveValue(), myString);
-
-        delete df;
+        localeDateFormat(state, false)->format(primitiveValue(), myString);
 
         return new UTF16String(myString);
 #else
@@ -1280,10 +1300,7 @@ String* DateObject::toLocaleTimeString(ExecutionState& state)
     if (IS_VALID_TIME(m_primitiveValue)) {
 #ifdef ENABLE_ICU
         icu::UnicodeString myString;
-        icu::DateFormat* tf = icu::DateFormat::createTimeInstance(icu::DateFormat::MEDIUM, state.context()->vmInstance()->locale());
-        tf->format(primitiveValue(), myString);
-
-        delete tf;
+        localeDateFormat(state, true)->format(primitiveValue(), myString);
 
         return new UTF16String(myString);
 #else
@@ -1391,16 +1408,13 @@ DECLARE_DATE_UTC_GETTER(Seconds);
 
 void* DateObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(DateObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(DateObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(DateObject, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(DateObject, m_values));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(DateObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(DateObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 }
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "ExternalString.h"
+
+namespace Escargot {
+
+void* ExternalString::operator new(size_t size)
+{
+    static GC_descr descr = [] {
+        // buffer and callback data are not GC memory
+        GC_word obj_bitmap[GC_BITMAP_SIZE(ExternalString)] = { 0 };
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ExternalString));
+    }();
+    Heap::objectAllocationCounts().m_stringCount.increase();
+    return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
+}
+
+void ExternalString::registerFinalizerIfNeeded()
+{
+    if (!m_releaseCallback) {
+        return;
+    }
+
+    GC_REGISTER_FINALIZER_NO_ORDER(this, [](void* obj,
+                                            void*) {
+        ExternalString* self = (ExternalString*)obj;
+        self->m_releaseCallback(self->m_bufferAccessData.buffer, self->m_bufferAccessData.length, self->m_callbackData);
+    },
+                                   nullptr, nullptr, nullptr);
+}
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotExternalString__
+#define __EscargotExternalString__
+
+#include "runtime/String.h"
+
+namespace Escargot {
+
+// String which refers a buffer owned by embedder without copying it.
+// buffer is not allocated by GC, so it should be immutable and alive until m_releaseCallback is called.
+// m_releaseCallback is called from finalizer of this string (eg. free or munmap the buffer there)
+class ExternalString : public String {
+public:
+    typedef void (*ReleaseCallback)(const void* buffer, size_t length, void* callbackData);
+
+    ExternalString(const LChar* buffer, size_t length, ReleaseCallback releaseCallback, void* callbackData)
+        : String()
+        , m_releaseCallback(releaseCallback)
+        , m_callbackData(callbackData)
+    {
+        m_bufferAccessData.has8BitContent = true;
+        m_bufferAccessData.length = length;
+        m_bufferAccessData.buffer = buffer;
+        registerFinalizerIfNeeded();
+    }
+
+    ExternalString(const char16_t* buffer, size_t length, ReleaseCallback releaseCallback, void* callbackData)
+        : String()
+        , m_releaseCallback(releaseCallback)
+        , m_callbackData(callbackData)
+    {
+        m_bufferAccessData.has8BitContent = false;
+        m_bufferAccessData.length = length;
+        m_bufferAccessData.buffer = buffer;
+        registerFinalizerIfNeeded();
+    }
+
+    virtual char16_t charAt(const size_t& idx) const
+    {
+        return m_bufferAccessData.charAt(idx);
+    }
+
+    virtual size_t length() const
+    {
+        return m_bufferAccessData.length;
+    }
+
+    virtual const LChar* characters8() const
+    {
+        ASSERT(has8BitContent());
+        return (const LChar*)m_bufferAccessData.buffer;
+    }
+
+    virtual const char16_t* characters16() const
+    {
+        ASSERT(!has8BitContent());
+        return (const char16_t*)m_bufferAccessData.buffer;
+    }
+
+    virtual UTF16StringData toUTF16StringData() const
+    {
+        UTF16StringData ret;
+        size_t len = length();
+        ret.resizeWithUninitializedValues(len);
+
+        for (size_t i = 0; i < len; i++) {
+            ret[i] = charAt(i);
+        }
+
+        return ret;
+    }
+
+    virtual UTF8StringData toUTF8StringData() const
+    {
+        return bufferAccessData().toUTF8String<UTF8StringData, UTF8StringDataNonGCStd>();
+    }
+
+    virtual UTF8StringDataNonGCStd toNonGCUTF8StringData() const
+    {
+        return bufferAccessData().toUTF8String<UTF8StringDataNonGCStd>();
+    }
+
+    void* operator new(size_t size);
+    void* operator new[](size_t size) = delete;
+
+private:
+    void registerFinalizerIfNeeded();
+
+    ReleaseCallback m_releaseCallback;
+    void* m_callbackData;
+};
+}
+
+#endif
@@ -283,6 +283,25 @@ Object* FunctionObject::newInstance(ExecutionState& state, const size_t& argc, V
         return receiver;
 }
 
+// calling bound function forwards to target function without its own frame.
+// arguments are copied only if it has bound arguments
+Value FunctionObject::callBoundFunction(ExecutionState& state, const size_t& argc, Value* argv)
+{
+    CallBoundFunctionData* data = m_codeBlock->boundFunctionInfo();
+    size_t boundArgc = data->m_boundArgumentsCount;
+    if (LIKELY(boundArgc == 0)) {
+        return FunctionObject::call(state, (FunctionObject*)data->m_ctorFn, data->m_boundThis, argc, argv);
+    }
+
+    size_t mergedArgc = boundArgc + argc;
+    Value* mergedArgv = ALLOCA(mergedArgc * sizeof(Value), Value, state);
+    for (size_t i = 0; i < boundArgc; i++) {
+        mergedArgv[i] = data->m_boundArguments[i];
+    }
+    memcpy(mergedArgv + boundArgc, argv, sizeof(Value) * argc);
+    return FunctionObject::call(state, (FunctionObject*)data->m_ctorFn, data->m_boundThis, mergedArgc, mergedArgv);
+}
+
 Value FunctionObject::processCall(ExecutionState& state, const Value& receiverSrc, const size_t& argc, Value* argv, bool isNewExpression)
 {
     volatile int sp;
@@ -299,6 +318,10 @@ Value FunctionObject::processCall(ExecutionState& state, const Value& receiverSr
     bool isStrict = m_codeBlock->isStrict();
 
     if (!m_codeBlock->isInterpretedCodeBlock()) {
+        if (m_codeBlock->isBindedFunction() && !isNewExpression) {
+            return callBoundFunction(state, argc, argv);
+        }
+
         CallNativeFunctionData* code = m_codeBlock->nativeFunctionData();
         FunctionEnvironmentRecordSimple record(this);
         LexicalEnvironment env(&record, outerEnvironment());
@@ -492,6 +515,11 @@ void FunctionObject::generateArgumentsObject(ExecutionState& state, FunctionEnvi
         for (size_t i = 0; i < v.size(); i++) {
             if (v[i].m_name == arguments) {
                 if (v[i].m_needToAllocateOnStack) {
+                    if (fnRecord->functionObject()->codeBlock()->asInterpretedCodeBlock()->hasLazyArgumentsObject()) {
+                        // LoadArgumentsObject creates it when it is needed
+                        stackStorage[v[i].m_indexForIndexedStorage] = Value(Value::EmptyValue);
+                        break;
+                    }
                     stackStorage[v[i].m_indexForIndexedStorage] = fnRecord->createArgumentsObject(state, state.executionContext());
                 } else {
                     ASSERT(fnRecord->isFunctionEnvironmentRecordOnHeap());
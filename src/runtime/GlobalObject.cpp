@@ -303,22 +303,6 @@ static int parseDigit(char16_t c, int radix)
     return digit;
 }
 
-static const int SizeOfInfinity = 8;
-
-static bool isInfinity(String* str, unsigned p, unsigned length)
-{
-    return (length - p) >= SizeOfInfinity
-        && str->charAt(p) == 'I'
-        && str->charAt(p + 1) == 'n'
-        && str->charAt(p + 2) == 'f'
-        && str->charAt(p + 3) == 'i'
-        && str->charAt(p + 4) == 'n'
-        && str->charAt(p + 5) == 'i'
-        && str->charAt(p + 6) == 't'
-        && str->charAt(p + 7) == 'y';
-}
-
-
 static Value builtinParseInt(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
     Value ret;
@@ -381,22 +365,31 @@ static Value builtinParseInt(ExecutionState& state, Value thisValue, size_t argc
     //     and if R is not 2, 4, 8, 10, 16, or 32, then mathInt may be an implementation-dependent approximation to the mathematical integer value
     //     that is represented by Z in radix-R notation.)
     // 14. Let number be the Number value for mathInt.
-    bool sawDigit = false;
-    double number = 0.0;
-    while (p < strLen) {
-        int digit = parseDigit(s->charAt(p), radix);
-        if (digit == -1)
-            break;
-        sawDigit = true;
-        number *= radix;
-        number += digit;
-        p++;
+    const auto& data = s->bufferAccessData();
+    unsigned digitEnd = p;
+    while (digitEnd < strLen && parseDigit(data.charAt(digitEnd), radix) != -1) {
+        digitEnd++;
     }
 
     // 12. If Z is empty, return NaN.
-    if (!sawDigit)
+    if (digitEnd == p)
         return Value(std::numeric_limits<double>::quiet_NaN());
 
+    double number = 0.0;
+    if (radix == 10) {
+        // decimal digits are rounded correctly by the shared parser
+        if (data.has8BitContent) {
+            parseDecimalLiteral((const LChar*)data.buffer + p, (const LChar*)data.buffer + digitEnd, number);
+        } else {
+            parseDecimalLiteral((const char16_t*)data.buffer + p, (const char16_t*)data.buffer + digitEnd, number);
+        }
+    } else {
+        for (; p < digitEnd; p++) {
+            number *= radix;
+            number += parseDigit(data.charAt(p), radix);
+        }
+    }
+
     // 15. Return sign × number.
     return Value(sign * number);
 }
@@ -406,61 +399,36 @@ static Value builtinParseFloat(ExecutionState& state, Value thisValue, size_t ar
     // 1. Let inputString be ToString(string).
     Value input = argv[0];
     String* s = input.toString(state);
-    size_t strLen = s->length();
-
-    if (strLen == 1) {
-        if (isdigit(s->charAt(0)))
-            return Value(s->charAt(0) - '0');
-        return Value(std::numeric_limits<double>::quiet_NaN());
-    }
+    const auto& data = s->bufferAccessData();
 
     // 2, Let trimmedString be a substring of inputString consisting of the leftmost character
     //    that is not a StrWhiteSpaceChar and all characters to the right of that character.
     //    (In other words, remove leading white space.)
-    unsigned p = 0;
-    unsigned len = s->length();
-
+    size_t p = 0;
+    size_t len = data.length;
     for (; p < len; p++) {
-        if (!(EscargotLexer::isWhiteSpaceOrLineTerminator(s->charAt(p))))
+        if (!(EscargotLexer::isWhiteSpaceOrLineTerminator(data.charAt(p))))
             break;
     }
 
-    // empty string
-    if (p == len)
-        return Value(std::numeric_limits<double>::quiet_NaN());
-
-    char16_t ch = s->charAt(p);
-    // HexIntegerLiteral
-    if (len - p > 1 && ch == '0' && toupper(s->charAt(p + 1)) == 'X')
-        return Value(0);
-
     // 3. If neither trimmedString nor any prefix of trimmedString satisfies the syntax of
     //    a StrDecimalLiteral (see 9.3.1), return NaN.
     // 4. Let numberString be the longest prefix of trimmedString, which might be trimmedString itself,
     //    that satisfies the syntax of a StrDecimalLiteral.
-    // Check the syntax of StrDecimalLiteral
-    switch (ch) {
-    case 'I':
-        if (isInfinity(s, p, len))
-            return Value(std::numeric_limits<double>::infinity());
-        break;
-    case '+':
-        if (isInfinity(s, p + 1, len))
-            return Value(std::numeric_limits<double>::infinity());
-        break;
-    case '-':
-        if (isInfinity(s, p + 1, len))
-            return Value(-std::numeric_limits<double>::infinity());
-        break;
+    // 5. Return the Number value for the MV of numberString.
+    double number;
+    bool parsed;
+    if (data.has8BitContent) {
+        const LChar* start = (const LChar*)data.buffer + p;
+        parsed = parseDecimalLiteral(start, (const LChar*)data.buffer + len, number) != start;
+    } else {
+        const char16_t* start = (const char16_t*)data.buffer + p;
+        parsed = parseDecimalLiteral(start, (const char16_t*)data.buffer + len, number) != start;
     }
-    auto u8Str = s->substring(p, len)->toUTF8StringData();
-    double number = atof(u8Str.data());
-    if (number == 0.0 && !std::signbit(number) && !isdigit(ch) && !(len - p >= 1 && (ch == '.' || ch == '+') && isdigit(s->charAt(p + 1))))
-        return Value(std::numeric_limits<double>::quiet_NaN());
-    if (number == std::numeric_limits<double>::infinity())
-        return Value(std::numeric_limits<double>::quiet_NaN());
 
-    // 5. Return the Number value for the MV of numberString.
+    if (!parsed) {
+        return Value(std::numeric_limits<double>::quiet_NaN());
+    }
     return Value(number);
 }
 
@@ -169,6 +169,10 @@ public:
     {
         return m_functionPrototype;
     }
+    FunctionObject* functionPrototypeCall()
+    {
+        return m_functionPrototypeCall;
+    }
 
     FunctionObject* error()
     {
@@ -344,6 +348,9 @@ public:
     }
 
     const Vector<String*, gc_allocator<String*>>& intlNumberFormatAvailableLocales();
+
+    // returns collator of fn if fn is compare function of Intl.Collator
+    static UCollator* collatorOfCompareFunction(const Value& fn);
 #endif
 #if ESCARGOT_ENABLE_PROMISE
     FunctionObject* promise()
@@ -554,6 +561,7 @@ protected:
 
     FunctionObject* m_function;
     FunctionObject* m_functionPrototype;
+    FunctionObject* m_functionPrototypeCall;
 
     Object* m_iteratorPrototype;
 
@@ -60,7 +60,7 @@ Value builtinArrayConstructor(ExecutionState& state, Value thisValue, size_t arg
         if (argc > 1 || !val.isInt32()) {
             if (array->isFastModeArray()) {
                 for (size_t idx = 0; idx < argc; idx++) {
-                    array->m_fastModeData[idx] = argv[idx];
+                    array->setFastModeElement(idx, argv[idx]);
                 }
             } else {
                 for (size_t idx = 0; idx < argc; idx++) {
@@ -343,6 +343,54 @@ static Value builtinArraySort(ExecutionState& state, Value thisValue, size_t arg
     }
     bool defaultSort = (argc == 0) || cmpfn.isUndefined();
 
+#if defined(ENABLE_ICU) && defined(ENABLE_INTL)
+    // sorting with Intl.Collator().compare collates same strings O(n log n) times.
+    // we make sort key of each string once and compare keys instead
+    UCollator* collator = defaultSort ? nullptr : GlobalObject::collatorOfCompareFunction(cmpfn);
+    if (collator) {
+        std::unordered_map<String*, std::string> sortKeys;
+        auto sortKeyOf = [collator, &sortKeys](String* str) -> const std::string& {
+            auto iter = sortKeys.find(str);
+            if (iter != sortKeys.end()) {
+                return iter->second;
+            }
+
+            auto utf16 = str->toUTF16StringData();
+            std::string key;
+            key.resize(std::max(utf16.length() * 2, (size_t)32));
+            int32_t keyLength = ucol_getSortKey(collator, (const UChar*)utf16.data(), utf16.length(), (uint8_t*)&key[0], key.size());
+            if ((size_t)keyLength > key.size()) {
+                key.resize(keyLength);
+                ucol_getSortKey(collator, (const UChar*)utf16.data(), utf16.length(), (uint8_t*)&key[0], key.size());
+            }
+            // keyLength includes terminating zero
+            key.resize(keyLength ? keyLength - 1 : 0);
+            return sortKeys.insert(std::make_pair(str, std::move(key))).first->second;
+        };
+
+        thisObject->sort(state, [&cmpfn, &state, &sortKeyOf](const Value& a, const Value& b) -> bool {
+            if (a.isEmpty() && b.isUndefined())
+                return false;
+            if (a.isUndefined() && b.isEmpty())
+                return true;
+            if (a.isEmpty() || a.isUndefined())
+                return false;
+            if (b.isEmpty() || b.isUndefined())
+                return true;
+            if (a.isString() && b.isString()) {
+                const std::string& keyA = sortKeyOf(a.asString());
+                const std::string& keyB = sortKeyOf(b.asString());
+                return keyA.compare(keyB) < 0;
+            }
+            // toString of other values can be observed, so let compare function do it
+            Value arg[2] = { a, b };
+            Value ret = FunctionObject::call(state, cmpfn, Value(), 2, arg);
+            return (ret.toNumber(state) < 0);
+        });
+        return thisObject;
+    }
+#endif
+
     thisObject->sort(state, [defaultSort, &cmpfn, &state](const Value& a, const Value& b) -> bool {
         if (a.isEmpty() && b.isUndefined())
             return false;
@@ -169,14 +169,7 @@ static Value builtinFunctionApply(ExecutionState& state, Value thisValue, size_t
         Object* obj = argArray.asObject();
         arrlen = obj->length(state);
         arguments = ALLOCA(sizeof(Value) * arrlen, Value, state);
-        for (size_t i = 0; i < arrlen; i++) {
-            auto re = obj->getIndexedProperty(state, Value(i));
-            if (re.hasValue()) {
-                arguments[i] = re.value(state, obj);
-            } else {
-                arguments[i] = Value();
-            }
-        }
+        obj->getIndexedProperties(state, arrlen, arguments);
     } else {
         ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, state.context()->staticStrings().Function.string(), true, state.context()->staticStrings().apply.string(), errorMessage_GlobalObject_SecondArgumentNotObject);
     }
@@ -191,12 +184,8 @@ static Value builtinFunctionCall(ExecutionState& state, Value thisValue, size_t
     FunctionObject* thisVal = thisValue.asFunction();
     Value thisArg = argv[0];
     size_t arrlen = argc > 0 ? argc - 1 : 0;
-    Value* arguments = ALLOCA(sizeof(Value) * arrlen, Value, state);
-    for (size_t i = 0; i < arrlen; i++) {
-        arguments[i] = argv[i + 1];
-    }
 
-    return thisVal->call(state, thisArg, arrlen, arguments);
+    return thisVal->call(state, thisArg, arrlen, argv + 1);
 }
 
 static Value builtinFunctionBind(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
@@ -237,7 +226,10 @@ void GlobalObject::installFunction(ExecutionState& state)
     FunctionObject* emptyFunction = new FunctionObject(state, new CodeBlock(state.context(), NativeFunctionInfo(state.context()->staticStrings().Function, builtinFunctionEmptyFunction, 0, nullptr, 0)),
                                                        FunctionObject::__ForGlobalBuiltin__);
 
-    g_functionObjectTag = *((size_t*)emptyFunction);
+    static std::once_flag functionObjectTagInitFlag;
+    std::call_once(functionObjectTagInitFlag, [emptyFunction]() {
+        g_functionObjectTag = *((size_t*)emptyFunction);
+    });
 
     m_functionPrototype = emptyFunction;
     m_functionPrototype->setPrototype(state, m_objectPrototype);
@@ -262,8 +254,9 @@ void GlobalObject::installFunction(ExecutionState& state)
     m_functionPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().apply),
                                                           ObjectPropertyDescriptor(new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().apply, builtinFunctionApply, 2, nullptr, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
+    m_functionPrototypeCall = new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().call, builtinFunctionCall, 1, nullptr, NativeFunctionInfo::Strict));
     m_functionPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().call),
-                                                          ObjectPropertyDescriptor(new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().call, builtinFunctionCall, 1, nullptr, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+                                                          ObjectPropertyDescriptor(m_functionPrototypeCall, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_functionPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().bind),
                                                           ObjectPropertyDescriptor(new FunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().bind, builtinFunctionBind, 1, nullptr, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
@@ -46,6 +46,7 @@
 #include "Escargot.h"
 #include "GlobalObject.h"
 #include "Context.h"
+#include "VMInstance.h"
 #include "StringObject.h"
 #include "ArrayObject.h"
 
@@ -1168,10 +1169,6 @@ static void initializeCollator(ExecutionState& state, Object* collator, Value lo
         CollatorResolvedOptions opt = collatorResolvedOptions(state, internalSlot);
         UErrorCode status = U_ZERO_ERROR;
         String* locale = opt.locale;
-        UCollator* collator = ucol_open(locale->toUTF8StringData().data(), &status);
-        if (U_FAILURE(status)) {
-            return;
-        }
 
         UColAttributeValue strength = UCOL_PRIMARY;
         UColAttributeValue caseLevel = UCOL_OFF;
@@ -1186,23 +1183,46 @@ static void initializeCollator(ExecutionState& state, Object* collator, Value lo
         } else {
             ASSERT_NOT_REACHED();
         }
+        bool numeric = opt.numeric;
+        bool ignorePunctuation = opt.ignorePunctuation;
 
-        ucol_setAttribute(collator, UCOL_STRENGTH, strength, &status);
-        ucol_setAttribute(collator, UCOL_CASE_LEVEL, caseLevel, &status);
+        auto localeData = locale->toUTF8StringData();
+        std::string cacheKey = "collator:";
+        cacheKey.append(localeData.data(), localeData.length());
+        cacheKey += ':';
+        cacheKey += std::to_string(strength) + ',' + std::to_string(caseLevel) + ',' + (numeric ? '1' : '0') + ',' + (ignorePunctuation ? '1' : '0');
+
+        ICUObjectCache& cache = state.context()->vmInstance()->icuObjectCache();
+        UCollator* cachedCollator = (UCollator*)cache.find(cacheKey);
+        if (!cachedCollator) {
+            cachedCollator = ucol_open(localeData.data(), &status);
+            if (U_FAILURE(status)) {
+                return;
+            }
 
-        bool numeric = opt.numeric;
-        ucol_setAttribute(collator, UCOL_NUMERIC_COLLATION, numeric ? UCOL_ON : UCOL_OFF, &status);
+            ucol_setAttribute(cachedCollator, UCOL_STRENGTH, strength, &status);
+            ucol_setAttribute(cachedCollator, UCOL_CASE_LEVEL, caseLevel, &status);
+            ucol_setAttribute(cachedCollator, UCOL_NUMERIC_COLLATION, numeric ? UCOL_ON : UCOL_OFF, &status);
 
-        // FIXME: Setting UCOL_ALTERNATE_HANDLING to UCOL_SHIFTED causes punctuation and whitespace to be
-        // ignored. There is currently no way to ignore only punctuation.
-        bool ignorePunctuation = opt.ignorePunctuation;
-        ucol_setAttribute(collator, UCOL_ALTERNATE_HANDLING, ignorePunctuation ? UCOL_SHIFTED : UCOL_DEFAULT, &status);
+            // FIXME: Setting UCOL_ALTERNATE_HANDLING to UCOL_SHIFTED causes punctuation and whitespace to be
+            // ignored. There is currently no way to ignore only punctuation.
+            ucol_setAttribute(cachedCollator, UCOL_ALTERNATE_HANDLING, ignorePunctuation ? UCOL_SHIFTED : UCOL_DEFAULT, &status);
+
+            // "The method is required to return 0 when comparing Strings that are considered canonically
+            // equivalent by the Unicode standard."
+            ucol_setAttribute(cachedCollator, UCOL_NORMALIZATION_MODE, UCOL_ON, &status);
+            if (U_FAILURE(status)) {
+                ucol_close(cachedCollator);
+                return;
+            }
 
-        // "The method is required to return 0 when comparing Strings that are considered canonically
-        // equivalent by the Unicode standard."
-        ucol_setAttribute(collator, UCOL_NORMALIZATION_MODE, UCOL_ON, &status);
+            cache.insert(cacheKey, cachedCollator, [](void* object) {
+                ucol_close((UCollator*)object);
+            });
+        }
+
+        UCollator* collator = ucol_safeClone(cachedCollator, nullptr, nullptr, &status);
         if (U_FAILURE(status)) {
-            ucol_close(collator);
             return;
         }
 
@@ -1294,6 +1314,20 @@ static Value builtinIntlCollatorCompare(ExecutionState& state, Value thisValue,
     return Value(result);
 }
 
+UCollator* GlobalObject::collatorOfCompareFunction(const Value& fn)
+{
+    if (!fn.isFunction()) {
+        return nullptr;
+    }
+
+    FunctionObject* function = fn.asFunction();
+    CodeBlock* codeBlock = function->codeBlock();
+    if (!codeBlock->hasCallNativeFunctionCode() || codeBlock->nativeFunctionData()->m_fn != builtinIntlCollatorCompare || !function->hasInternalSlot()) {
+        return nullptr;
+    }
+    return (UCollator*)function->internalSlot()->extraData();
+}
+
 static Value builtinIntlCollatorCompareGetter(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
     if (!thisValue.isObject() || !thisValue.asObject()->hasInternalSlot() || !thisValue.asObject()->internalSlot()->hasOwnProperty(state, ObjectPropertyName(state, String::fromASCII("initializedCollator")))) {
@@ -1431,23 +1465,23 @@ static const size_t indexOfExtensionKeyNu = 1;
 
 static std::vector<std::string> numberingSystemsForLocale(String* locale)
 {
-    static std::vector<std::string> availableNumberingSystems;
-
-    UErrorCode status = U_ZERO_ERROR;
-    if (availableNumberingSystems.size() == 0) {
+    static const std::vector<std::string> availableNumberingSystems = [] {
+        std::vector<std::string> result;
+        UErrorCode status = U_ZERO_ERROR;
         UEnumeration* numberingSystemNames = unumsys_openAvailableNames(&status);
         ASSERT(U_SUCCESS(status));
 
         int32_t resultLength;
         // Numbering system names are always ASCII, so use char[].
-        while (const char* result = uenum_next(numberingSystemNames, &resultLength, &status)) {
+        while (const char* name = uenum_next(numberingSystemNames, &resultLength, &status)) {
             ASSERT(U_SUCCESS(status));
-            availableNumberingSystems.push_back(std::string(result, resultLength));
+            result.push_back(std::string(name, resultLength));
         }
         uenum_close(numberingSystemNames);
-    }
+        return result;
+    }();
 
-    status = U_ZERO_ERROR;
+    UErrorCode status = U_ZERO_ERROR;
     UNumberingSystem* defaultSystem = unumsys_open(locale->toUTF8StringData().data(), &status);
     ASSERT(U_SUCCESS(status));
     std::string defaultSystemName(unumsys_getName(defaultSystem));
@@ -1929,7 +1963,28 @@ static void initializeDateTimeFormat(ExecutionState& state, Object* dateTimeForm
     status = U_ZERO_ERROR;
     UTF16StringData timeZoneView = dateTimeFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("timeZone"))).value(state, dateTimeFormat->internalSlot()).toString(state)->toUTF16StringData();
     UTF8StringData localeStringView = r->at(String::fromASCII("locale"))->toUTF8StringData();
-    UDateFormat* icuDateFormat = udat_open(UDAT_IGNORE, UDAT_IGNORE, localeStringView.data(), (UChar*)timeZoneView.data(), timeZoneView.length(), (UChar*)patternBuffer.data(), patternBuffer.length(), &status);
+    // pattern and time zone are UTF-16, so they are appended to key as raw code units
+    std::string cacheKey = "datetimeformat:";
+    cacheKey.append(localeStringView.data(), localeStringView.length());
+    cacheKey += ':';
+    cacheKey.append((const char*)timeZoneView.data(), timeZoneView.length() * sizeof(char16_t));
+    cacheKey += ':';
+    cacheKey.append((const char*)patternBuffer.data(), patternBuffer.length() * sizeof(char16_t));
+
+    ICUObjectCache& cache = state.context()->vmInstance()->icuObjectCache();
+    UDateFormat* cachedDateFormat = (UDateFormat*)cache.find(cacheKey);
+    if (!cachedDateFormat) {
+        cachedDateFormat = udat_open(UDAT_IGNORE, UDAT_IGNORE, localeStringView.data(), (UChar*)timeZoneView.data(), timeZoneView.length(), (UChar*)patternBuffer.data(), patternBuffer.length(), &status);
+        if (U_FAILURE(status)) {
+            ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "failed to initialize DateTimeFormat");
+            return;
+        }
+        cache.insert(cacheKey, cachedDateFormat, [](void* object) {
+            udat_close((UDateFormat*)object);
+        });
+    }
+
+    UDateFormat* icuDateFormat = udat_clone(cachedDateFormat, &status);
     if (U_FAILURE(status)) {
         ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "failed to initialize DateTimeFormat");
         return;
@@ -2366,29 +2421,75 @@ static void initializeNumberFormat(ExecutionState& state, Object* numberFormat,
         }
     }
 
-    UErrorCode status = U_ZERO_ERROR;
-    String* localeOption = numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("locale"))).value(state, numberFormat->internalSlot()).toString(state);
-    UNumberFormat* unumberFormat = unum_open(style, nullptr, 0, localeOption->toUTF8StringData().data(), nullptr, &status);
-    if (U_FAILURE(status)) {
-        ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "Failed to init NumberFormat");
+    Object* internalSlot = numberFormat->internalSlot();
+    String* localeOption = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("locale"))).value(state, internalSlot).toString(state);
+    String* currencyString = nullptr;
+    if (styleOption->equals("currency")) {
+        currencyString = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("currency"))).value(state, internalSlot).toString(state);
+    }
+    bool useSignificantDigits = internalSlot->hasOwnProperty(state, ObjectPropertyName(state, String::fromASCII("minimumSignificantDigits")));
+    int32_t digits[3];
+    if (!useSignificantDigits) {
+        digits[0] = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("minimumIntegerDigits"))).value(state, internalSlot).toNumber(state);
+        digits[1] = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("minimumFractionDigits"))).value(state, internalSlot).toNumber(state);
+        digits[2] = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("maximumFractionDigits"))).value(state, internalSlot).toNumber(state);
+    } else {
+        digits[0] = 0;
+        digits[1] = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("minimumSignificantDigits"))).value(state, internalSlot).toNumber(state);
+        digits[2] = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("maximumSignificantDigits"))).value(state, internalSlot).toNumber(state);
     }
+    bool useGrouping = internalSlot->get(state, ObjectPropertyName(state, String::fromASCII("useGrouping"))).value(state, internalSlot).toBoolean(state);
 
-    if (styleOption->equals("currency")) {
-        String* currencyString = numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("currency"))).value(state, numberFormat->internalSlot()).toString(state);
-        unum_setTextAttribute(unumberFormat, UNUM_CURRENCY_CODE, (UChar*)currencyString->toUTF16StringData().data(), 3, &status);
+    auto localeData = localeOption->toUTF8StringData();
+    std::string cacheKey = "numberformat:";
+    cacheKey.append(localeData.data(), localeData.length());
+    cacheKey += ':' + std::to_string(style);
+    if (currencyString) {
+        auto currencyData = currencyString->toUTF8StringData();
+        cacheKey += ':';
+        cacheKey.append(currencyData.data(), currencyData.length());
+    }
+    cacheKey += std::string(useSignificantDigits ? ":s" : ":f") + (useGrouping ? 'g' : '-');
+    for (size_t i = 0; i < 3; i++) {
+        cacheKey += ',' + std::to_string(digits[i]);
     }
 
-    if (!numberFormat->internalSlot()->hasOwnProperty(state, ObjectPropertyName(state, String::fromASCII("minimumSignificantDigits")))) {
-        unum_setAttribute(unumberFormat, UNUM_MIN_INTEGER_DIGITS, numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("minimumIntegerDigits"))).value(state, numberFormat->internalSlot()).toNumber(state));
-        unum_setAttribute(unumberFormat, UNUM_MIN_FRACTION_DIGITS, numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("minimumFractionDigits"))).value(state, numberFormat->internalSlot()).toNumber(state));
-        unum_setAttribute(unumberFormat, UNUM_MAX_FRACTION_DIGITS, numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("maximumFractionDigits"))).value(state, numberFormat->internalSlot()).toNumber(state));
-    } else {
-        unum_setAttribute(unumberFormat, UNUM_SIGNIFICANT_DIGITS_USED, true);
-        unum_setAttribute(unumberFormat, UNUM_MIN_SIGNIFICANT_DIGITS, numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("minimumSignificantDigits"))).value(state, numberFormat->internalSlot()).toNumber(state));
-        unum_setAttribute(unumberFormat, UNUM_MAX_SIGNIFICANT_DIGITS, numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("maximumSignificantDigits"))).value(state, numberFormat->internalSlot()).toNumber(state));
+    UErrorCode status = U_ZERO_ERROR;
+    ICUObjectCache& cache = state.context()->vmInstance()->icuObjectCache();
+    UNumberFormat* cachedFormat = (UNumberFormat*)cache.find(cacheKey);
+    if (!cachedFormat) {
+        cachedFormat = unum_open(style, nullptr, 0, localeData.data(), nullptr, &status);
+        if (U_FAILURE(status)) {
+            ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "Failed to init NumberFormat");
+        }
+
+        if (currencyString) {
+            unum_setTextAttribute(cachedFormat, UNUM_CURRENCY_CODE, (UChar*)currencyString->toUTF16StringData().data(), 3, &status);
+        }
+
+        if (!useSignificantDigits) {
+            unum_setAttribute(cachedFormat, UNUM_MIN_INTEGER_DIGITS, digits[0]);
+            unum_setAttribute(cachedFormat, UNUM_MIN_FRACTION_DIGITS, digits[1]);
+            unum_setAttribute(cachedFormat, UNUM_MAX_FRACTION_DIGITS, digits[2]);
+        } else {
+            unum_setAttribute(cachedFormat, UNUM_SIGNIFICANT_DIGITS_USED, true);
+            unum_setAttribute(cachedFormat, UNUM_MIN_SIGNIFICANT_DIGITS, digits[1]);
+            unum_setAttribute(cachedFormat, UNUM_MAX_SIGNIFICANT_DIGITS, digits[2]);
+        }
+        unum_setAttribute(cachedFormat, UNUM_GROUPING_USED, useGrouping);
+        unum_setAttribute(cachedFormat, UNUM_ROUNDING_MODE, UNUM_ROUND_HALFUP);
+        if (U_FAILURE(status)) {
+            unum_close(cachedFormat);
+            ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "Failed to init NumberFormat");
+        }
+
+        cache.insert(cacheKey, cachedFormat, [](void* object) {
+            unum_close((UNumberFormat*)object);
+        });
     }
-    unum_setAttribute(unumberFormat, UNUM_GROUPING_USED, numberFormat->internalSlot()->get(state, ObjectPropertyName(state, String::fromASCII("useGrouping"))).value(state, numberFormat->internalSlot()).toBoolean(state));
-    unum_setAttribute(unumberFormat, UNUM_ROUNDING_MODE, UNUM_ROUND_HALFUP);
+
+    // each NumberFormat owns a clone, so closing it in finalizer never touches the cached one
+    UNumberFormat* unumberFormat = unum_clone(cachedFormat, &status);
     if (U_FAILURE(status)) {
         ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "Failed to init NumberFormat");
     }
@@ -277,6 +277,394 @@ static Value builtinJSONParse(ExecutionState& state, Value thisValue, size_t arg
     return unfiltered;
 }
 
+// serializes plain data objects and fast-mode arrays into a single growable buffer.
+// nothing in these values can call user code, so it just gives up on anything else,
+// and the caller runs the generic algorithm from the start
+class JSONFastStringifier {
+public:
+    explicit JSONFastStringifier(ExecutionState& state)
+        : m_state(state)
+        , m_objectPrototype(state.context()->globalObject()->objectPrototype())
+        , m_arrayPrototype(state.context()->globalObject()->arrayPrototype())
+        , m_is8Bit(true)
+    {
+    }
+
+    // returns nullptr when the value needs the generic algorithm
+    String* stringify(Object* value)
+    {
+        if (!prototypesHaveNoToJSON() || !appendObjectOrArray(value)) {
+            return nullptr;
+        }
+
+        if (m_is8Bit) {
+            if (UNLIKELY(m_latin1.length() > STRING_MAXIMUM_LENGTH)) {
+                return nullptr;
+            }
+            return new Latin1String(m_latin1.data(), m_latin1.length());
+        }
+        if (UNLIKELY(m_utf16.length() > STRING_MAXIMUM_LENGTH)) {
+            return nullptr;
+        }
+        return new UTF16String(m_utf16.data(), m_utf16.length());
+    }
+
+private:
+    enum { MaxDepth = 512 };
+
+    static bool needsEscape(char16_t c)
+    {
+        return c < ' ' || c == '"' || c == '\\';
+    }
+
+    // checks 8 characters at once whether one of them is below ' ', '"' or '\\'
+    static bool hasCharacterNeedsEscape(uint64_t word)
+    {
+        const uint64_t ones = 0x0101010101010101ULL;
+        const uint64_t highBits = 0x8080808080808080ULL;
+        uint64_t quote = word ^ (ones * '"');
+        uint64_t backslash = word ^ (ones * '\\');
+        return ((word - ones * ' ') & ~word & highBits)
+            | ((quote - ones) & ~quote & highBits)
+            | ((backslash - ones) & ~backslash & highBits);
+    }
+
+    template <typename Buffer>
+    static void appendEscaped(Buffer& buffer, char16_t c)
+    {
+        buffer.push_back('\\');
+        switch (c) {
+        case '"':
+        case '\\':
+            buffer.push_back(c);
+            break;
+        case '\b':
+            buffer.push_back('b');
+            break;
+        case '\f':
+            buffer.push_back('f');
+            break;
+        case '\n':
+            buffer.push_back('n');
+            break;
+        case '\r':
+            buffer.push_back('r');
+            break;
+        case '\t':
+            buffer.push_back('t');
+            break;
+        default: {
+            const char* hex = "0123456789abcdef";
+            buffer.push_back('u');
+            buffer.push_back('0');
+            buffer.push_back('0');
+            buffer.push_back(hex[c >> 4]);
+            buffer.push_back(hex[c & 0xf]);
+            break;
+        }
+        }
+    }
+
+    template <typename Buffer>
+    static void appendQuotedLatin1(Buffer& buffer, const LChar* src, size_t length)
+    {
+        buffer.push_back('"');
+        size_t runStart = 0;
+        size_t i = 0;
+        while (i < length) {
+            if (i + 8 <= length) {
+                uint64_t word;
+                memcpy(&word, src + i, sizeof(word));
+                if (!hasCharacterNeedsEscape(word)) {
+                    i += 8;
+                    continue;
+                }
+            }
+            if (needsEscape(src[i])) {
+                buffer.append(src + runStart, src + i);
+                appendEscaped(buffer, src[i]);
+                runStart = i + 1;
+            }
+            i++;
+        }
+        buffer.append(src + runStart, src + length);
+        buffer.push_back('"');
+    }
+
+    template <typename Buffer>
+    static void appendQuotedUTF16(Buffer& buffer, const char16_t* src, size_t length)
+    {
+        buffer.push_back('"');
+        for (size_t i = 0; i < length; i++) {
+            if (UNLIKELY(needsEscape(src[i]))) {
+                appendEscaped(buffer, src[i]);
+            } else {
+                buffer.push_back(src[i]);
+            }
+        }
+        buffer.push_back('"');
+    }
+
+    static bool isLatin1(const char16_t* src, size_t length)
+    {
+        for (size_t i = 0; i < length; i++) {
+            if (src[i] > 0xff) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void convertTo16Bit()
+    {
+        ASSERT(m_is8Bit);
+        m_utf16.assign(m_latin1.begin(), m_latin1.end());
+        m_latin1.clear();
+        m_latin1.shrink_to_fit();
+        m_is8Bit = false;
+    }
+
+    void appendRaw(const char* src, size_t length)
+    {
+        if (LIKELY(m_is8Bit)) {
+            m_latin1.append((const LChar*)src, length);
+        } else {
+            m_utf16.append(src, src + length);
+        }
+    }
+
+    void appendChar(char c)
+    {
+        if (LIKELY(m_is8Bit)) {
+            m_latin1.push_back(c);
+        } else {
+            m_utf16.push_back(c);
+        }
+    }
+
+    // appends string which is already quoted
+    void appendString(String* str)
+    {
+        const StringBufferAccessData& data = str->bufferAccessData();
+        if (data.has8BitContent) {
+            const LChar* src = (const LChar*)data.buffer;
+            if (LIKELY(m_is8Bit)) {
+                m_latin1.append(src, data.length);
+            } else {
+                m_utf16.append(src, src + data.length);
+            }
+        } else {
+            const char16_t* src = (const char16_t*)data.buffer;
+            if (m_is8Bit && !isLatin1(src, data.length)) {
+                convertTo16Bit();
+            }
+            if (m_is8Bit) {
+                m_latin1.append(src, src + data.length);
+            } else {
+                m_utf16.append(src, data.length);
+            }
+        }
+    }
+
+    void appendQuotedString(String* str)
+    {
+        const StringBufferAccessData& data = str->bufferAccessData();
+        if (data.has8BitContent) {
+            if (LIKELY(m_is8Bit)) {
+                appendQuotedLatin1(m_latin1, (const LChar*)data.buffer, data.length);
+            } else {
+                appendQuotedLatin1(m_utf16, (const LChar*)data.buffer, data.length);
+            }
+        } else {
+            const char16_t* src = (const char16_t*)data.buffer;
+            if (m_is8Bit && !isLatin1(src, data.length)) {
+                convertTo16Bit();
+            }
+            if (m_is8Bit) {
+                appendQuotedUTF16(m_latin1, src, data.length);
+            } else {
+                appendQuotedUTF16(m_utf16, src, data.length);
+            }
+        }
+    }
+
+    bool hasToJSON(Object* obj)
+    {
+        return obj->structure()->findProperty(PropertyName(m_state.context()->staticStrings().toJSON)) != SIZE_MAX;
+    }
+
+    // the chains are only Array.prototype -> Object.prototype -> null without toJSON.
+    // Object.prototype can get another prototype here (even a Proxy), so its end is checked too
+    bool prototypesHaveNoToJSON()
+    {
+        return !hasToJSON(m_objectPrototype) && !hasToJSON(m_arrayPrototype)
+            && m_arrayPrototype->getPrototypeObject(m_state) == m_objectPrototype
+            && m_objectPrototype->getPrototypeObject(m_state) == nullptr;
+    }
+
+    // checks and builds per-structure data once, so next objects of the structure only read slots
+    bool canStringifyStructure(ObjectStructure* structure, ObjectStructureEnumerationCache* cache)
+    {
+        if (LIKELY(cache->m_jsonStringifyState != ObjectStructureEnumerationCache::JSONStringifyUnknown)) {
+            return cache->m_jsonStringifyState == ObjectStructureEnumerationCache::JSONStringifyFast;
+        }
+
+        bool canStringify = !cache->m_hasIndexPropertyName && structure->findProperty(PropertyName(m_state.context()->staticStrings().toJSON)) == SIZE_MAX;
+        size_t keyCount = cache->m_propertyIndexes.size();
+        for (size_t i = 0; canStringify && i < keyCount; i++) {
+            canStringify = structure->readProperty(m_state, cache->m_propertyIndexes[i]).m_descriptor.isPlainDataProperty();
+        }
+
+        if (canStringify) {
+            for (size_t i = 0; i < keyCount; i++) {
+                String* key = cache->m_propertyNames[i].plainString();
+                const StringBufferAccessData& data = key->bufferAccessData();
+                String* quotedKey;
+                if (data.has8BitContent) {
+                    Latin1StringDataNonGCStd buffer;
+                    appendQuotedLatin1(buffer, (const LChar*)data.buffer, data.length);
+                    buffer.push_back(':');
+                    quotedKey = new Latin1String(buffer.data(), buffer.length());
+                } else {
+                    UTF16StringDataNonGCStd buffer;
+                    appendQuotedUTF16(buffer, (const char16_t*)data.buffer, data.length);
+                    buffer.push_back(':');
+                    quotedKey = new UTF16String(buffer.data(), buffer.length());
+                }
+                cache->m_jsonQuotedKeys.pushBack(quotedKey);
+            }
+        }
+
+        cache->m_jsonStringifyState = canStringify ? ObjectStructureEnumerationCache::JSONStringifyFast : ObjectStructureEnumerationCache::JSONStringifySlow;
+        return canStringify;
+    }
+
+    // same as what Str omits from objects
+    static bool isOmitted(const Value& value)
+    {
+        return value.isUndefined() || value.isSymbol() || value.isFunction();
+    }
+
+    bool appendValue(const Value& value)
+    {
+        ASSERT(!isOmitted(value));
+        if (value.isNull()) {
+            appendRaw("null", 4);
+        } else if (value.isBoolean()) {
+            if (value.asBoolean()) {
+                appendRaw("true", 4);
+            } else {
+                appendRaw("false", 5);
+            }
+        } else if (value.isInt32()) {
+            char buffer[16];
+            int length = snprintf(buffer, sizeof(buffer), "%d", value.asInt32());
+            appendRaw(buffer, length);
+        } else if (value.isNumber()) {
+            if (std::isfinite(value.asNumber())) {
+                appendString(value.toString(m_state));
+            } else {
+                appendRaw("null", 4);
+            }
+        } else if (value.isString()) {
+            appendQuotedString(value.asString());
+        } else if (value.isObject()) {
+            return appendObjectOrArray(value.asObject());
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    bool appendObjectOrArray(Object* obj)
+    {
+        // cyclic structure is reported by the generic algorithm
+        if (m_stack.size() >= MaxDepth) {
+            return false;
+        }
+        for (size_t i = 0; i < m_stack.size(); i++) {
+            if (m_stack[i] == obj) {
+                return false;
+            }
+        }
+
+        m_stack.pushBack(obj);
+        bool result = obj->isArrayObject() ? appendArray(obj->asArrayObject()) : appendObject(obj);
+        m_stack.pop_back();
+        return result;
+    }
+
+    bool appendObject(Object* obj)
+    {
+        // wrapper objects are unwrapped by the generic algorithm
+        if (!obj->isOrdinary() || !obj->canUseEnumerationCache() || obj->isNumberObject() || obj->isBooleanObject()
+            || obj->getPrototypeObject(m_state) != m_objectPrototype) {
+            return false;
+        }
+
+        ObjectStructure* structure = obj->structure();
+        ObjectStructureEnumerationCache* cache = structure->enumerationCache();
+        if (!canStringifyStructure(structure, cache)) {
+            return false;
+        }
+
+        appendChar('{');
+        bool isFirst = true;
+        size_t keyCount = cache->m_propertyIndexes.size();
+        for (size_t i = 0; i < keyCount; i++) {
+            Value value = obj->m_values[cache->m_propertyIndexes[i]];
+            if (isOmitted(value)) {
+                continue;
+            }
+            if (!isFirst) {
+                appendChar(',');
+            }
+            isFirst = false;
+            appendString(cache->m_jsonQuotedKeys[i]);
+            if (!appendValue(value)) {
+                return false;
+            }
+        }
+        appendChar('}');
+        return true;
+    }
+
+    bool appendArray(ArrayObject* arr)
+    {
+        if (!arr->isFastModeArray() || arr->getPrototypeObject(m_state) != m_arrayPrototype || hasToJSON(arr)) {
+            return false;
+        }
+
+        appendChar('[');
+        uint32_t length = arr->getArrayLength(m_state);
+        for (uint32_t i = 0; i < length; i++) {
+            if (i) {
+                appendChar(',');
+            }
+            Value value = arr->getFastModeElement(i);
+            // holes are read from prototype chain
+            if (value.isEmpty()) {
+                return false;
+            }
+            if (isOmitted(value)) {
+                appendRaw("null", 4);
+            } else if (!appendValue(value)) {
+                return false;
+            }
+        }
+        appendChar(']');
+        return true;
+    }
+
+    ExecutionState& m_state;
+    Object* m_objectPrototype;
+    Object* m_arrayPrototype;
+    bool m_is8Bit;
+    Latin1StringDataNonGCStd m_latin1;
+    UTF16StringDataNonGCStd m_utf16;
+    Vector<Object*, GCUtil::gc_malloc_ignore_off_page_allocator<Object*>> m_stack;
+};
+
 static Value builtinJSONStringify(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
     auto strings = &state.context()->staticStrings();
@@ -285,6 +673,14 @@ static Value builtinJSONStringify(ExecutionState& state, Value thisValue, size_t
     Value value = argv[0];
     Value replacer = argv[1];
     Value space = argv[2];
+
+    if (!replacer.isObject() && space.isUndefined() && value.isObject() && !value.isFunction()) {
+        JSONFastStringifier stringifier(state);
+        if (String* result = stringifier.stringify(value.asObject())) {
+            return result;
+        }
+    }
+
     String* indent = new ASCIIString("");
     ValueVector stack;
     std::vector<ObjectPropertyName, GCUtil::gc_malloc_ignore_off_page_allocator<ObjectPropertyName>> propertyList;
@@ -551,6 +947,12 @@ static Value builtinJSONStringify(ExecutionState& state, Value thisValue, size_t
         std::vector<ObjectPropertyName, GCUtil::gc_malloc_ignore_off_page_allocator<ObjectPropertyName>> k;
         if (propertyListTouched) {
             k = propertyList;
+        } else if (ObjectStructureEnumerationCache* cache = value->enumerationCache()) {
+            size_t keyCount = cache->m_propertyNames.size();
+            k.reserve(keyCount);
+            for (size_t i = 0; i < keyCount; i++) {
+                k.push_back(ObjectPropertyName(state, cache->m_propertyNames[i]));
+            }
         } else {
             value->enumeration(state, [](ExecutionState& state, Object* self, const ObjectPropertyName& P, const ObjectStructurePropertyDescriptor& desc, void* data) -> bool {
                 std::vector<ObjectPropertyName, GCUtil::gc_malloc_ignore_off_page_allocator<ObjectPropertyName>>* k = (std::vector<ObjectPropertyName, GCUtil::gc_malloc_ignore_off_page_allocator<ObjectPropertyName>>*)data;
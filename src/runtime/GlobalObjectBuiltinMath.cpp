@@ -380,8 +380,7 @@ static Value builtinMathLog2(ExecutionState& state, Value thisValue, size_t argc
 
 static Value builtinMathRandom(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
-    double rand = (double)std::rand() / RAND_MAX;
-    return Value(rand);
+    return Value(state.context()->randomGenerator().nextDouble());
 }
 
 static Value builtinMathExp(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
@@ -102,11 +102,8 @@ static Value builtinNumberToFixed(ExecutionState& state, Value thisValue, size_t
     }
 
     if (argc == 0) {
-        bool isInteger = (static_cast<int64_t>(number) == number);
-        if (isInteger) {
-            char buffer[256];
-            itoa(static_cast<int64_t>(number), buffer, 10);
-            return new ASCIIString(buffer);
+        if (isSafeIntegerDouble(number)) {
+            return String::fromInt64(static_cast<int64_t>(number));
         } else {
             return Value(round(number)).toString(state);
         }
@@ -125,6 +122,20 @@ static Value builtinNumberToFixed(ExecutionState& state, Value thisValue, size_t
             return Value(round(number)).toString(state);
         }
 
+        if (isSafeIntegerDouble(number)) {
+            // fraction of integer is all zeros
+            char buffer[ESCARGOT_INTEGER_TO_DECIMAL_BUFFER_LENGTH + 1 + 20];
+            char* integerEnd = buffer + ESCARGOT_INTEGER_TO_DECIMAL_BUFFER_LENGTH;
+            char* start = integerToDecimal(static_cast<int64_t>(number), integerEnd);
+            size_t length = integerEnd - start;
+            if (digit) {
+                integerEnd[0] = '.';
+                memset(integerEnd + 1, '0', digit);
+                length += digit + 1;
+            }
+            return new ASCIIString(start, length);
+        }
+
         char buffer[NUMBER_TO_STRING_BUFFER_LENGTH];
         double_conversion::StringBuilder builder(buffer, NUMBER_TO_STRING_BUFFER_LENGTH);
         double_conversion::DoubleToStringConverter::EcmaScriptConverter().ToFixed(number, digit, &builder);
@@ -206,6 +217,23 @@ static Value builtinNumberToPrecision(ExecutionState& state, Value thisValue, si
             if (p < 1 || p > 21) {
                 ErrorObject::throwBuiltinError(state, ErrorObject::RangeError, state.context()->staticStrings().Number.string(), true, state.context()->staticStrings().toPrecision.string(), errorMessage_GlobalObject_RangeError);
             }
+            if (isSafeIntegerDouble(number)) {
+                // integer which fits in precision doesn't need rounding nor exponent
+                char buffer[ESCARGOT_INTEGER_TO_DECIMAL_BUFFER_LENGTH + 1 + 21];
+                char* integerEnd = buffer + ESCARGOT_INTEGER_TO_DECIMAL_BUFFER_LENGTH;
+                char* start = integerToDecimal(static_cast<int64_t>(number), integerEnd);
+                int digitCount = integerEnd - start - (number < 0 ? 1 : 0);
+                if (digitCount <= p) {
+                    size_t length = integerEnd - start;
+                    if (digitCount < p) {
+                        integerEnd[0] = '.';
+                        memset(integerEnd + 1, '0', p - digitCount);
+                        length += p - digitCount + 1;
+                    }
+                    return new ASCIIString(start, length);
+                }
+            }
+
             char buffer[NUMBER_TO_STRING_BUFFER_LENGTH];
             double_conversion::StringBuilder builder(buffer, NUMBER_TO_STRING_BUFFER_LENGTH);
             double_conversion::DoubleToStringConverter::EcmaScriptConverter().ToPrecision(number, p, &builder);
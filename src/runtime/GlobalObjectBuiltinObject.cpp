@@ -488,6 +488,14 @@ static Value builtinObjectKeys(ExecutionState& state, Value thisValue, size_t ar
     // Let array be the result of creating a new object as if by the expression new Array(n) where Array is the standard built-in constructor with that name.
     ArrayObject* array = new ArrayObject(state);
 
+    if (ObjectStructureEnumerationCache* cache = O->enumerationCache()) {
+        SmallValueVector& keys = cache->m_keys;
+        array->setElements(state, 0, keys.size(), [&](size_t i) -> Value {
+            return keys[i];
+        });
+        return array;
+    }
+
     // Let index be 0.
     size_t index = 0;
 
@@ -602,9 +610,9 @@ static ArrayObject* createArrayFromList(ExecutionState& state, ValueVector& elem
     // Increment n by 1.
     // Return array.
     ArrayObject* array = new ArrayObject(state);
-    for (size_t n = 0; n < elements.size(); n++) {
-        array->defineOwnProperty(state, ObjectPropertyName(state, Value(n)), ObjectPropertyDescriptor(elements[n], ObjectPropertyDescriptor::AllPresent));
-    }
+    array->setElements(state, 0, elements.size(), [&](size_t n) -> Value {
+        return elements[n];
+    });
     return array;
 }
 
@@ -618,6 +626,44 @@ enum EnumerableOwnPropertiesType {
 static ValueVector enumerableOwnProperties(ExecutionState& state, Object* O, EnumerableOwnPropertiesType kind)
 {
     ValueVector properties;
+
+    // without index keys, order of structure is the order of enumeration
+    ObjectStructureEnumerationCache* cache = O->enumerationCache();
+    if (cache && !cache->m_hasIndexPropertyName) {
+        size_t keyCount = cache->m_keys.size();
+        properties.resizeWithUninitializedValues(keyCount);
+        size_t propertyCount = 0;
+        for (size_t i = 0; i < keyCount; i++) {
+            Value key = cache->m_keys[i];
+            ObjectPropertyName propertyName(state, cache->m_propertyNames[i]);
+            // getter of a previous property can delete or redefine this one
+            if (UNLIKELY(O->enumerationCache() != cache)) {
+                ObjectGetResult desc = O->getOwnProperty(state, propertyName);
+                if (!desc.hasValue() || !desc.isEnumerable()) {
+                    continue;
+                }
+            }
+
+            if (kind == EnumerableOwnPropertiesType::EnumerableOwnPropertiesTypeKey) {
+                properties[propertyCount++] = key;
+                continue;
+            }
+
+            Value value = O->get(state, propertyName).value(state, O);
+            if (kind == EnumerableOwnPropertiesType::EnumerableOwnPropertiesTypeValue) {
+                properties[propertyCount++] = value;
+            } else {
+                ArrayObject* entry = new ArrayObject(state);
+                Value entryValues[2] = { key, value };
+                entry->setElements(state, 0, 2, [&](size_t i) -> Value {
+                    return entryValues[i];
+                });
+                properties[propertyCount++] = entry;
+            }
+        }
+        properties.resize(propertyCount);
+        return properties;
+    }
     // Let ownKeys be ? O.[[OwnPropertyKeys]]().
     // Let properties be a new empty List.
     // For each element key of ownKeys in List order, do
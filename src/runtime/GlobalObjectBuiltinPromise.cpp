@@ -322,13 +322,13 @@ static Value builtinPromiseThen(ExecutionState& state, Value thisValue, size_t a
         break;
     }
     case PromiseObject::PromiseState::FulFilled: {
-        Job* job = new PromiseReactionJob(state.context(), PromiseReaction(onFulfilled, capability), promise->promiseResult());
-        state.context()->jobQueue()->enqueueJob(state, job);
+        DefaultJobQueue* jobQueue = DefaultJobQueue::get(state.context()->jobQueue());
+        jobQueue->enqueueJob(state, jobQueue->createPromiseReactionJob(state.context(), PromiseReaction(onFulfilled, capability), promise->promiseResult()));
         break;
     }
     case PromiseObject::PromiseState::Rejected: {
-        Job* job = new PromiseReactionJob(state.context(), PromiseReaction(onRejected, capability), promise->promiseResult());
-        state.context()->jobQueue()->enqueueJob(state, job);
+        DefaultJobQueue* jobQueue = DefaultJobQueue::get(state.context()->jobQueue());
+        jobQueue->enqueueJob(state, jobQueue->createPromiseReactionJob(state.context(), PromiseReaction(onRejected, capability), promise->promiseResult()));
         break;
     }
     default:
@@ -306,6 +306,50 @@ static Value builtinStringRepeat(ExecutionState& state, Value thisValue, size_t
     return builder.finalize();
 }
 
+static bool hasDollarSign(String* str)
+{
+    const auto& data = str->bufferAccessData();
+    if (data.has8BitContent) {
+        return memchr(data.buffer, '$', data.length) != nullptr;
+    }
+    for (size_t i = 0; i < data.length; i++) {
+        if (((const char16_t*)data.buffer)[i] == '$') {
+            return true;
+        }
+    }
+    return false;
+}
+
+// returns string which [start, end) of string is replaced with replacement
+static String* replaceSubstring(ExecutionState& state, String* string, size_t start, size_t end, String* replacement)
+{
+    const auto& data = string->bufferAccessData();
+    const auto& replacementData = replacement->bufferAccessData();
+    if (data.has8BitContent && replacementData.has8BitContent) {
+        size_t length = data.length - (end - start) + replacementData.length;
+        if (UNLIKELY(length > STRING_MAXIMUM_LENGTH)) {
+            ErrorObject::throwBuiltinError(state, ErrorObject::RangeError, errorMessage_String_InvalidStringLength);
+        }
+        if (!length) {
+            return String::emptyString;
+        }
+
+        Latin1StringData result;
+        result.resizeWithUninitializedValues(length);
+        LChar* dst = result.data();
+        memcpy(dst, data.buffer, start);
+        memcpy(dst + start, replacementData.buffer, replacementData.length);
+        memcpy(dst + start + replacementData.length, (const LChar*)data.buffer + end, data.length - end);
+        return new Latin1String(std::move(result));
+    }
+
+    StringBuilder builder;
+    builder.appendSubString(string, 0, start);
+    builder.appendString(replacement);
+    builder.appendSubString(string, end, data.length);
+    return builder.finalize(&state);
+}
+
 static Value builtinStringReplace(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
     RESOLVE_THIS_BINDING_TO_STRING(string, String, replace);
@@ -333,6 +377,16 @@ static Value builtinStringReplace(ExecutionState& state, Value thisValue, size_t
     } else {
         String* searchString = searchValue.toString(state);
         size_t idx = string->find(searchString);
+        if (!replaceValueIsFunction) {
+            // NOTE: replaceValue.toString should be called after searchValue.toString
+            replaceString = replaceValue.toString(state);
+            // string pattern matches once, so replacement without '$' is just a copy of three parts
+            if (idx == SIZE_MAX) {
+                return string;
+            } else if (!hasDollarSign(replaceString)) {
+                return replaceSubstring(state, string, idx, idx + searchString->length(), replaceString);
+            }
+        }
         if (idx != (size_t)-1) {
             std::vector<RegexMatchResult::RegexMatchResultPiece> piece;
             RegexMatchResult::RegexMatchResultPiece p;
@@ -344,7 +398,7 @@ static Value builtinStringReplace(ExecutionState& state, Value thisValue, size_t
     }
 
     // NOTE: replaceValue.toString should be called after searchValue.toString
-    if (!replaceValueIsFunction) {
+    if (!replaceValueIsFunction && !replaceString) {
         replaceString = replaceValue.toString(state);
     }
 
@@ -388,16 +442,8 @@ static Value builtinStringReplace(ExecutionState& state, Value thisValue, size_t
     } else {
         ASSERT(replaceString);
 
-        bool hasDollar = false;
-        for (size_t i = 0; i < replaceString->length(); i++) {
-            if (replaceString->charAt(i) == '$') {
-                hasDollar = true;
-                break;
-            }
-        }
-
         StringBuilder builder;
-        if (!hasDollar) {
+        if (!hasDollarSign(replaceString)) {
             // flat replace
             int32_t matchCount = result.m_matchResults.size();
             builder.appendSubString(string, 0, result.m_matchResults[0][0].m_start);
@@ -595,27 +641,43 @@ static Value builtinStringSplit(ExecutionState& state, Value thisValue, size_t a
             }
         }
     } else {
+        // literal separator doesn't have side effects while matching,
+        // so we collect all pieces first and store them into fast-mode array at once
         String* R = P->asString();
-        while (q != s) {
-            Value e = splitMatchUsingStr(S, q, R);
-            if (e == Value(false))
-                q++;
-            else {
-                if ((size_t)e.asInt32() == p)
-                    q++;
-                else {
-                    if (q >= S->length())
-                        break;
-
-                    String* T = S->substring(p, q);
-                    A->defineOwnProperty(state, ObjectPropertyName(state, Value(lengthA++)), ObjectPropertyDescriptor(T, ObjectPropertyDescriptor::AllPresent));
-                    if (lengthA == lim)
-                        return A;
-                    p = e.asInt32();
-                    q = p;
+        size_t r = R->length();
+        const StaticStrings& strings = state.context()->staticStrings();
+        auto piece = [S, &strings](size_t from, size_t to) -> String* {
+            if (to - from == 1) {
+                char16_t c = S->charAt(from);
+                if (c < ESCARGOT_ASCII_TABLE_MAX) {
+                    return strings.asciiTable[c].string();
+                }
+            }
+            return S->substring(from, to);
+        };
+
+        ValueVector pieces;
+        if (r == 0) {
+            size_t count = std::min(s, lim);
+            for (size_t i = 0; i < count; i++) {
+                pieces.pushBack(piece(i, i + 1));
+            }
+        } else {
+            while (pieces.size() < lim) {
+                size_t idx = S->find(R, p);
+                if (idx == SIZE_MAX) {
+                    pieces.pushBack(piece(p, s));
+                    break;
                 }
+                pieces.pushBack(piece(p, idx));
+                p = idx + r;
             }
         }
+
+        A->setElements(state, 0, pieces.size(), [&pieces](size_t i) -> Value {
+            return pieces[i];
+        });
+        return A;
     }
 
     // 14, 15, 16
@@ -629,16 +691,11 @@ static Value builtinStringCharCodeAt(ExecutionState& state, Value thisValue, siz
     RESOLVE_THIS_BINDING_TO_STRING(str, String, charCodeAt);
     int position = argv[0].toInteger(state);
     Value ret;
-    const auto& data = str->bufferAccessData();
-    if (position < 0 || position >= (int)data.length)
+    if (position < 0 || position >= (int)str->length())
         ret = Value(std::numeric_limits<double>::quiet_NaN());
     else {
-        char16_t c;
-        if (data.has8BitContent) {
-            c = ((LChar*)data.buffer)[position];
-        } else {
-            c = ((char16_t*)data.buffer)[position];
-        }
+        // rope can read a character without flattening
+        char16_t c = UNLIKELY(str->isRopeString()) ? str->charAt(position) : str->bufferAccessData().charAt(position);
         ret = Value(c);
     }
     return ret;
@@ -657,15 +714,8 @@ static Value builtinStringCharAt(ExecutionState& state, Value thisValue, size_t
         return Value(String::emptyString);
     }
 
-    const auto& accessData = str->bufferAccessData();
-
-    if (LIKELY(0 <= position && position < (int64_t)accessData.length)) {
-        char16_t c;
-        if (accessData.has8BitContent) {
-            c = ((LChar*)accessData.buffer)[position];
-        } else {
-            c = ((char16_t*)accessData.buffer)[position];
-        }
+    if (LIKELY(0 <= position && position < (int64_t)str->length())) {
+        char16_t c = UNLIKELY(str->isRopeString()) ? str->charAt(position) : str->bufferAccessData().charAt(position);
         if (LIKELY(c < ESCARGOT_ASCII_TABLE_MAX)) {
             return state.context()->staticStrings().asciiTable[c].string();
         } else {
@@ -715,91 +765,124 @@ static Value builtinStringSlice(ExecutionState& state, Value thisValue, size_t a
     return str->substring(from, from + span);
 }
 
-static Value builtinStringToLowerCase(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
+// returns bits 0x20 of ASCII letters to convert in word which has ASCII characters only.
+// xor with it converts case of the letters
+template <bool isUpperCase>
+static ALWAYS_INLINE uint64_t asciiCaseConversionMask(uint64_t word)
 {
-    RESOLVE_THIS_BINDING_TO_STRING(str, String, toLowerCase);
-    if (str->has8BitContent()) {
-        Latin1StringData newStr;
-        size_t len = str->length();
-        newStr.resizeWithUninitializedValues(len);
-        const LChar* buf = str->characters8();
-        bool result = true;
-        for (size_t i = 0; i < len; i++) {
-            char32_t u2 = u_tolower(buf[i]);
-            if (UNLIKELY(u2 > 255)) {
-                result = false;
-                break;
+    const uint64_t ones = 0x0101010101010101ULL;
+    const uint64_t highBits = 0x8080808080808080ULL;
+    const uint64_t first = isUpperCase ? 'a' : 'A';
+    const uint64_t last = isUpperCase ? 'z' : 'Z';
+    // each byte is less than 0x80, so additions below never carry into next byte
+    uint64_t aboveFirst = word + ones * (0x80 - first);
+    uint64_t aboveLast = word + ones * (0x80 - last - 1);
+    return ((aboveFirst & ~aboveLast) & highBits) >> 2;
+}
+
+template <bool isUpperCase>
+static ALWAYS_INLINE char32_t convertCase(char32_t c)
+{
+    return isUpperCase ? u_toupper(c) : u_tolower(c);
+}
+
+// converts 8-bit string into result.
+// returns false if there is a character which is not in Latin1 after conversion
+template <bool isUpperCase>
+static bool convertLatin1Case(const LChar* src, size_t length, LChar* result)
+{
+    size_t i = 0;
+    while (i < length) {
+        if (i + sizeof(uint64_t) <= length) {
+            uint64_t word;
+            memcpy(&word, src + i, sizeof(word));
+            if (!(word & 0x8080808080808080ULL)) {
+                word ^= asciiCaseConversionMask<isUpperCase>(word);
+                memcpy(result + i, &word, sizeof(word));
+                i += sizeof(uint64_t);
+                continue;
             }
-            newStr[i] = u2;
         }
-        if (result)
-            return new Latin1String(std::move(newStr));
+
+        LChar c = src[i];
+        if (c < 0x80) {
+            result[i] = (isUpperCase ? (c >= 'a' && c <= 'z') : (c >= 'A' && c <= 'Z')) ? (c ^ 0x20) : c;
+        } else {
+            char32_t converted = convertCase<isUpperCase>(c);
+            if (UNLIKELY(converted > 0xFF)) {
+                return false;
+            }
+            result[i] = converted;
+        }
+        i++;
     }
+    return true;
+}
 
-    size_t len = str->length();
-    UTF16StringData newStr;
-    if (str->has8BitContent()) {
-        const LChar* buf = str->characters8();
-        newStr.resizeWithUninitializedValues(len);
-        for (size_t i = 0; i < len; i++) {
-            newStr[i] = buf[i];
+// returns length of prefix which is not changed by conversion
+template <bool isUpperCase>
+static size_t unchangedLatin1CasePrefixLength(const LChar* src, size_t length)
+{
+    size_t i = 0;
+    while (i < length) {
+        if (i + sizeof(uint64_t) <= length) {
+            uint64_t word;
+            memcpy(&word, src + i, sizeof(word));
+            if (!(word & 0x8080808080808080ULL) && !asciiCaseConversionMask<isUpperCase>(word)) {
+                i += sizeof(uint64_t);
+                continue;
+            }
         }
-    } else
-        newStr = UTF16StringData(str->characters16(), len);
-    char16_t* buf = newStr.data();
-    for (size_t i = 0; i < len;) {
-        char32_t c;
-        size_t iBefore = i;
-        U16_NEXT(buf, i, len, c);
-        c = u_tolower(c);
-        if (c <= 0x10000) {
-            char16_t c2 = (char16_t)c;
-            buf[iBefore] = c2;
-        } else {
-            buf[iBefore] = (char16_t)(0xD800 + ((c - 0x10000) >> 10));
-            buf[iBefore + 1] = (char16_t)(0xDC00 + ((c - 0x10000) & 1023));
+
+        LChar c = src[i];
+        if (c < 0x80 ? (isUpperCase ? (c >= 'a' && c <= 'z') : (c >= 'A' && c <= 'Z')) : convertCase<isUpperCase>(c) != c) {
+            return i;
         }
+        i++;
     }
-    return new UTF16String(std::move(newStr));
+    return length;
 }
 
-static Value builtinStringToUpperCase(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
+template <bool isUpperCase>
+static String* stringConvertCase(String* str)
 {
-    RESOLVE_THIS_BINDING_TO_STRING(str, String, toUpperCase);
-    if (str->has8BitContent()) {
+    const auto& data = str->bufferAccessData();
+    size_t len = data.length;
+    if (data.has8BitContent) {
+        const LChar* buf = (const LChar*)data.buffer;
+        // it is common that nothing changes (e.g. normalizing header names),
+        // so we don't make new string in that case
+        size_t unchanged = unchangedLatin1CasePrefixLength<isUpperCase>(buf, len);
+        if (unchanged == len) {
+            return str;
+        }
+
         Latin1StringData newStr;
-        size_t len = str->length();
         newStr.resizeWithUninitializedValues(len);
-        const LChar* buf = str->characters8();
-        bool result = true;
-        for (size_t i = 0; i < len; i++) {
-            char32_t u2 = u_toupper(buf[i]);
-            if (UNLIKELY(u2 > 255)) {
-                result = false;
-                break;
-            }
-            newStr[i] = u2;
-        }
-        if (result)
+        memcpy(newStr.data(), buf, unchanged);
+        if (convertLatin1Case<isUpperCase>(buf + unchanged, len - unchanged, newStr.data() + unchanged)) {
             return new Latin1String(std::move(newStr));
+        }
     }
 
-    size_t len = str->length();
     UTF16StringData newStr;
-    if (str->has8BitContent()) {
-        const LChar* buf = str->characters8();
+    if (data.has8BitContent) {
+        const LChar* buf = (const LChar*)data.buffer;
         newStr.resizeWithUninitializedValues(len);
         for (size_t i = 0; i < len; i++) {
             newStr[i] = buf[i];
         }
     } else
-        newStr = UTF16StringData(str->characters16(), len);
+        newStr = UTF16StringData((const char16_t*)data.buffer, len);
+    bool changed = data.has8BitContent;
     char16_t* buf = newStr.data();
     for (size_t i = 0; i < len;) {
         char32_t c;
         size_t iBefore = i;
         U16_NEXT(buf, i, len, c);
-        c = u_toupper(c);
+        char32_t converted = convertCase<isUpperCase>(c);
+        changed |= (converted != c);
+        c = converted;
         if (c <= 0x10000) {
             char16_t c2 = (char16_t)c;
             buf[iBefore] = c2;
@@ -808,9 +891,24 @@ static Value builtinStringToUpperCase(ExecutionState& state, Value thisValue, si
             buf[iBefore + 1] = (char16_t)(0xDC00 + ((c - 0x10000) & 1023));
         }
     }
+    if (!changed) {
+        return str;
+    }
     return new UTF16String(std::move(newStr));
 }
 
+static Value builtinStringToLowerCase(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
+{
+    RESOLVE_THIS_BINDING_TO_STRING(str, String, toLowerCase);
+    return stringConvertCase<false>(str);
+}
+
+static Value builtinStringToUpperCase(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
+{
+    RESOLVE_THIS_BINDING_TO_STRING(str, String, toUpperCase);
+    return stringConvertCase<true>(str);
+}
+
 static Value builtinStringToLocaleLowerCase(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
     RESOLVE_THIS_BINDING_TO_STRING(str, String, toLocaleLowerCase);
@@ -823,19 +921,33 @@ static Value builtinStringToLocaleUpperCase(ExecutionState& state, Value thisVal
     return builtinStringToUpperCase(state, thisValue, argc, argv, isNewExpression);
 }
 
+template <typename CharType>
+static void trimmedRange(const CharType* buf, size_t length, size_t& start, size_t& end)
+{
+    start = 0;
+    end = length;
+    while (start < end && EscargotLexer::isWhiteSpaceOrLineTerminator(buf[start])) {
+        start++;
+    }
+    while (end > start && EscargotLexer::isWhiteSpaceOrLineTerminator(buf[end - 1])) {
+        end--;
+    }
+}
+
 static Value builtinStringTrim(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
     RESOLVE_THIS_BINDING_TO_STRING(str, String, trim);
-    int64_t s, e;
-    for (s = 0; s < (int64_t)str->length(); s++) {
-        if (!EscargotLexer::isWhiteSpaceOrLineTerminator((*str)[s]))
-            break;
+    const auto& data = str->bufferAccessData();
+    size_t s, e;
+    if (data.has8BitContent) {
+        trimmedRange((const LChar*)data.buffer, data.length, s, e);
+    } else {
+        trimmedRange((const char16_t*)data.buffer, data.length, s, e);
     }
-    for (e = ((int64_t)str->length()) - 1; e >= s; e--) {
-        if (!EscargotLexer::isWhiteSpaceOrLineTerminator((*str)[e]))
-            break;
+    if (s == 0 && e == data.length) {
+        return str;
     }
-    return new StringView(str, s, e + 1);
+    return str->substring(s, e);
 }
 
 static Value builtinStringValueOf(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
@@ -880,16 +992,7 @@ static Value builtinStringStartsWith(ExecutionState& state, Value thisValue, siz
     }
     // If the sequence of elements of S starting at start of length searchLength is the same as the full element sequence of searchStr, return true.
     // Otherwise, return false.
-    const auto& srcData = S->bufferAccessData();
-    const auto& src2Data = searchStr->bufferAccessData();
-
-    for (size_t i = 0; i < src2Data.length; i++) {
-        if (srcData.charAt(i + start) != src2Data.charAt(i)) {
-            return Value(false);
-        }
-    }
-
-    return Value(true);
+    return Value(String::compareRange(S, (size_t)start, searchStr, 0, (size_t)searchLength) == 0);
 }
 
 static Value builtinStringEndsWith(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
@@ -927,15 +1030,7 @@ static Value builtinStringEndsWith(ExecutionState& state, Value thisValue, size_
         return Value(false);
     }
     // If the sequence of elements of S starting at start of length searchLength is the same as the full element sequence of searchStr, return true.
-    const auto& srcData = S->bufferAccessData();
-    const auto& src2Data = searchStr->bufferAccessData();
-    for (size_t i = 0; i < searchLength; i++) {
-        if (srcData.charAt(i + start) != src2Data.charAt(i)) {
-            return Value(false);
-        }
-    }
-
-    return Value(true);
+    return Value(String::compareRange(S, (size_t)start, searchStr, 0, (size_t)searchLength) == 0);
 }
 
 // ( template, ...substitutions )
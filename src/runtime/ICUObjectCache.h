@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotICUObjectCache__
+#define __EscargotICUObjectCache__
+
+#ifdef ENABLE_ICU
+
+namespace Escargot {
+
+// opened ICU objects (collators, formatters) by their locale and options.
+// opening one loads locale data, which is much slower than cloning an opened one,
+// so users clone the cached object and own the clone.
+// objects used without cloning should not be kept across another insert
+class ICUObjectCache {
+public:
+    typedef void (*Closer)(void* object);
+
+    ~ICUObjectCache()
+    {
+        clear();
+    }
+
+    // returns nullptr if there is no object for the key
+    void* find(const std::string& key)
+    {
+        for (auto iter = m_entries.begin(); iter != m_entries.end(); iter++) {
+            if (iter->m_key == key) {
+                // move to front as the most recently used one
+                if (iter != m_entries.begin()) {
+                    m_entries.splice(m_entries.begin(), m_entries, iter);
+                }
+                return m_entries.front().m_object;
+            }
+        }
+        return nullptr;
+    }
+
+    // cache owns the object, and closes it with closer when it is evicted
+    void insert(const std::string& key, void* object, Closer closer)
+    {
+        ASSERT(!find(key));
+        if (m_entries.size() >= MaxSize) {
+            Entry& last = m_entries.back();
+            last.m_closer(last.m_object);
+            m_entries.pop_back();
+        }
+        m_entries.push_front(Entry{ key, object, closer });
+    }
+
+    void clear()
+    {
+        for (auto& entry : m_entries) {
+            entry.m_closer(entry.m_object);
+        }
+        m_entries.clear();
+    }
+
+private:
+    enum { MaxSize = 16 };
+
+    struct Entry {
+        std::string m_key;
+        void* m_object;
+        Closer m_closer;
+    };
+
+    std::list<Entry> m_entries;
+};
+}
+
+#endif
+
+#endif
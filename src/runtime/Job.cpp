@@ -27,64 +27,65 @@
 
 namespace Escargot {
 
-SandBox::SandBoxResult PromiseReactionJob::run()
+SandBox::SandBoxResult Job::run()
 {
     SandBox sandbox(relatedContext());
     ExecutionState state(relatedContext());
     return sandbox.run([&]() -> Value {
-        /* 25.4.2.1.4 Handler is "Identity" case */
-        if (m_reaction.m_handler == (FunctionObject*)1) {
-            Value value[] = { m_argument };
-            return FunctionObject::call(state, m_reaction.m_capability.m_resolveFunction, Value(), 1, value);
-        }
+        return execute(state);
+    });
+}
+
+Value PromiseReactionJob::execute(ExecutionState& state)
+{
+    /* 25.4.2.1.4 Handler is "Identity" case */
+    if (m_reaction.m_handler == (FunctionObject*)1) {
+        Value value[] = { m_argument };
+        return FunctionObject::call(state, m_reaction.m_capability.m_resolveFunction, Value(), 1, value);
+    }
 
-        /* 25.4.2.1.5 Handler is "Thrower" case */
-        if (m_reaction.m_handler == (FunctionObject*)2) {
-            Value value[] = { m_argument };
-            return FunctionObject::call(state, m_reaction.m_capability.m_rejectFunction, Value(), 1, value);
-        }
+    /* 25.4.2.1.5 Handler is "Thrower" case */
+    if (m_reaction.m_handler == (FunctionObject*)2) {
+        Value value[] = { m_argument };
+        return FunctionObject::call(state, m_reaction.m_capability.m_rejectFunction, Value(), 1, value);
+    }
 
-        SandBox sb(state.context());
-        auto res = sb.run([&]() -> Value {
-            Value arguments[] = { m_argument };
-            Value res = FunctionObject::call(state, m_reaction.m_handler, Value(), 1, arguments);
-            Value value[] = { res };
-            return FunctionObject::call(state, m_reaction.m_capability.m_resolveFunction, Value(), 1, value);
-        });
-        if (!res.error.isEmpty()) {
-            Value reason[] = { res.error };
-            return FunctionObject::call(state, m_reaction.m_capability.m_rejectFunction, Value(), 1, reason);
-        }
-        return res.result;
+    SandBox sb(state.context());
+    auto res = sb.run([&]() -> Value {
+        Value arguments[] = { m_argument };
+        Value res = FunctionObject::call(state, m_reaction.m_handler, Value(), 1, arguments);
+        Value value[] = { res };
+        return FunctionObject::call(state, m_reaction.m_capability.m_resolveFunction, Value(), 1, value);
     });
+    if (!res.error.isEmpty()) {
+        Value reason[] = { res.error };
+        return FunctionObject::call(state, m_reaction.m_capability.m_rejectFunction, Value(), 1, reason);
+    }
+    return res.result;
 }
 
-SandBox::SandBoxResult PromiseResolveThenableJob::run()
+Value PromiseResolveThenableJob::execute(ExecutionState& state)
 {
-    SandBox sandbox(relatedContext());
-    ExecutionState state(relatedContext());
-    return sandbox.run([&]() -> Value {
-        auto strings = &state.context()->staticStrings();
-        PromiseReaction::Capability capability = m_promise->createResolvingFunctions(state);
-
-        SandBox sb(state.context());
-        auto res = sb.run([&]() -> Value {
-            Value arguments[] = { capability.m_resolveFunction, capability.m_rejectFunction };
-            Value thenCallResult = FunctionObject::call(state, m_then, m_thenable, 2, arguments);
-            Value value[] = { thenCallResult };
-            return Value();
-        });
-        if (!res.error.isEmpty()) {
-            Object* alreadyResolved = PromiseObject::resolvingFunctionAlreadyResolved(state, capability.m_resolveFunction);
-            if (alreadyResolved->getOwnProperty(state, strings->value).value(state, alreadyResolved).asBoolean())
-                return Value();
-            alreadyResolved->setThrowsException(state, strings->value, Value(true), alreadyResolved);
+    auto strings = &state.context()->staticStrings();
+    PromiseReaction::Capability capability = m_promise->createResolvingFunctions(state);
 
-            Value reason[] = { res.error };
-            return FunctionObject::call(state, capability.m_rejectFunction, Value(), 1, reason);
-        }
+    SandBox sb(state.context());
+    auto res = sb.run([&]() -> Value {
+        Value arguments[] = { capability.m_resolveFunction, capability.m_rejectFunction };
+        Value thenCallResult = FunctionObject::call(state, m_then, m_thenable, 2, arguments);
+        Value value[] = { thenCallResult };
         return Value();
     });
+    if (!res.error.isEmpty()) {
+        Object* alreadyResolved = PromiseObject::resolvingFunctionAlreadyResolved(state, capability.m_resolveFunction);
+        if (alreadyResolved->getOwnProperty(state, strings->value).value(state, alreadyResolved).asBoolean())
+            return Value();
+        alreadyResolved->setThrowsException(state, strings->value, Value(true), alreadyResolved);
+
+        Value reason[] = { res.error };
+        return FunctionObject::call(state, capability.m_rejectFunction, Value(), 1, reason);
+    }
+    return Value();
 }
 }
 
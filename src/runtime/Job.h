@@ -51,7 +51,11 @@ public:
         RELEASE_ASSERT_NOT_REACHED();
     }
 
-    virtual SandBox::SandBoxResult run() = 0;
+    // runs job in its own SandBox
+    SandBox::SandBoxResult run();
+    // exception from job is thrown to caller. caller should prepare SandBox for relatedContext
+    virtual Value execute(ExecutionState& state) = 0;
+
     Context* relatedContext() const
     {
         return m_relatedContext;
@@ -62,7 +66,7 @@ public:
         return m_type;
     }
 
-private:
+protected:
     JobType m_type;
     Context* m_relatedContext;
 };
@@ -76,7 +80,14 @@ public:
     {
     }
 
-    SandBox::SandBoxResult run();
+    Value execute(ExecutionState& state);
+
+    void reset(Context* relatedContext, const PromiseReaction& reaction, const Value& argument)
+    {
+        m_relatedContext = relatedContext;
+        m_reaction = reaction;
+        m_argument = argument;
+    }
 
 private:
     PromiseReaction m_reaction;
@@ -93,7 +104,7 @@ public:
     {
     }
 
-    SandBox::SandBoxResult run();
+    Value execute(ExecutionState& state);
 
 private:
     PromiseObject* m_promise;
@@ -35,13 +35,73 @@ JobQueue* JobQueue::create()
 
 size_t DefaultJobQueue::enqueueJob(ExecutionState& state, Job* job)
 {
-    if (state.context()->vmInstance()->m_jobQueueListener) {
-        state.context()->vmInstance()->m_jobQueueListener(state, job);
+    VMInstance* instance = state.context()->vmInstance();
+    if (instance->m_jobQueueListener) {
+        instance->m_jobQueueListener(state, job);
     } else {
-        m_jobs.push_back(job);
+        if (UNLIKELY(m_size == m_capacity)) {
+            grow();
+        }
+        m_buffer[(m_head + m_size) & (m_capacity - 1)] = job;
+        m_size++;
+        if (m_size == 1 && instance->m_pendingJobListener) {
+            instance->m_pendingJobListener(instance, instance->m_pendingJobListenerData);
+        }
     }
     return 0;
 }
+
+void DefaultJobQueue::grow()
+{
+    size_t newCapacity = m_capacity ? m_capacity * 2 : 16;
+    Job** newBuffer = (Job**)GC_MALLOC(sizeof(Job*) * newCapacity);
+    for (size_t i = 0; i < m_size; i++) {
+        newBuffer[i] = m_buffer[(m_head + i) & (m_capacity - 1)];
+    }
+    if (m_buffer) {
+        GC_FREE(m_buffer);
+    }
+    m_buffer = newBuffer;
+    m_capacity = newCapacity;
+    m_head = 0;
+}
+
+void DefaultJobQueue::removeJobsOf(Context* context)
+{
+    size_t newSize = 0;
+    for (size_t i = 0; i < m_size; i++) {
+        Job* job = m_buffer[(m_head + i) & (m_capacity - 1)];
+        if (job->relatedContext() != context) {
+            m_buffer[(m_head + newSize) & (m_capacity - 1)] = job;
+            newSize++;
+        }
+    }
+    for (size_t i = newSize; i < m_size; i++) {
+        m_buffer[(m_head + i) & (m_capacity - 1)] = nullptr;
+    }
+    m_size = newSize;
+}
+
+PromiseReactionJob* DefaultJobQueue::createPromiseReactionJob(Context* relatedContext, const PromiseReaction& reaction, const Value& argument)
+{
+    if (m_reactionJobPoolSize) {
+        PromiseReactionJob* job = m_reactionJobPool[--m_reactionJobPoolSize];
+        m_reactionJobPool[m_reactionJobPoolSize] = nullptr;
+        job->reset(relatedContext, reaction, argument);
+        return job;
+    }
+    return new PromiseReactionJob(relatedContext, reaction, argument);
+}
+
+void DefaultJobQueue::recycleJob(Job* job)
+{
+    if (job->type() == Job::PromiseReactionJob && m_reactionJobPoolSize < ReactionJobPoolCapacity) {
+        PromiseReactionJob* reactionJob = (PromiseReactionJob*)job;
+        // drop references so pooled job does not keep them alive
+        reactionJob->reset(nullptr, PromiseReaction(), Value());
+        m_reactionJobPool[m_reactionJobPoolSize++] = reactionJob;
+    }
+}
 }
 
 #endif
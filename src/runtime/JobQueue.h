@@ -37,9 +37,19 @@ public:
     virtual size_t enqueueJob(ExecutionState& state, Job* job) = 0;
 };
 
+// jobs are kept in a ring buffer, so enqueueing a job does not allocate anything
+// unless the buffer is full. PromiseReactionJobs ran by drain are kept in a small pool to be reused
 class DefaultJobQueue : public JobQueue {
 private:
-    DefaultJobQueue() {}
+    DefaultJobQueue()
+        : m_buffer(nullptr)
+        , m_capacity(0)
+        , m_head(0)
+        , m_size(0)
+        , m_reactionJobPoolSize(0)
+    {
+    }
+
 public:
     static DefaultJobQueue* create()
     {
@@ -49,29 +59,52 @@ public:
     size_t enqueueJob(ExecutionState& state, Job* job);
     bool hasNextJob()
     {
-        return !m_jobs.empty();
+        return m_size;
     }
 
-    Job* nextJob()
+    size_t pendingJobCount()
     {
-        ASSERT(!m_jobs.empty());
-        Job* job = m_jobs.front();
-        m_jobs.pop_front();
-        return job;
+        return m_size;
+    }
+
+    Job* peekJob()
+    {
+        ASSERT(m_size);
+        return m_buffer[m_head];
     }
 
-    std::list<Job*, gc_allocator<Job*>>& impl()
+    Job* nextJob()
     {
-        return m_jobs;
+        ASSERT(m_size);
+        Job* job = m_buffer[m_head];
+        m_buffer[m_head] = nullptr;
+        m_head = (m_head + 1) & (m_capacity - 1);
+        m_size--;
+        return job;
     }
 
+    void removeJobsOf(Context* context);
+
+    PromiseReactionJob* createPromiseReactionJob(Context* relatedContext, const PromiseReaction& reaction, const Value& argument);
+    // job should not be referenced by anyone
+    void recycleJob(Job* job);
+
     static DefaultJobQueue* get(JobQueue* jobQueue)
     {
         return (DefaultJobQueue*)jobQueue;
     }
 
 private:
-    std::list<Job*, gc_allocator<Job*>> m_jobs;
+    void grow();
+
+    enum { ReactionJobPoolCapacity = 32 };
+
+    Job** m_buffer;
+    size_t m_capacity;
+    size_t m_head;
+    size_t m_size;
+    size_t m_reactionJobPoolSize;
+    PromiseReactionJob* m_reactionJobPool[ReactionJobPoolCapacity];
 };
 }
 #endif // ESCARGOT_ENABLE_PROMISE
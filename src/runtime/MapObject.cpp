@@ -32,17 +32,14 @@ MapObject::MapObject(ExecutionState& state)
 
 void* MapObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(MapObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(MapObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(MapObject, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(MapObject, m_values));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(MapObject, m_storage));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(MapObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(MapObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
@@ -156,17 +153,14 @@ MapIteratorObject::MapIteratorObject(ExecutionState& state, MapObject* map, Type
 
 void* MapIteratorObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(MapIteratorObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(MapIteratorObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(MapIteratorObject, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(MapIteratorObject, m_values));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(MapIteratorObject, m_map));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(MapIteratorObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(MapIteratorObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
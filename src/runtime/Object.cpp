@@ -93,18 +93,15 @@ ObjectRareData::ObjectRareData(Object* obj)
 
 void* ObjectRareData::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(ObjectRareData)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectRareData, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectRareData, m_extraData));
 #ifdef ESCARGOT_ENABLE_PROMISE
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectRareData, m_internalSlot));
 #endif
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ObjectRareData));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ObjectRareData));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
@@ -397,7 +394,10 @@ Object* Object::createBuiltinObjectPrototype(ExecutionState& state)
     Object* obj = new Object(state, ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER, false);
     obj->m_structure = state.context()->defaultStructureForObject();
     obj->m_prototype = nullptr;
-    g_objectTag = *((size_t*)obj);
+    static std::once_flag objectTagInitFlag;
+    std::call_once(objectTagInitFlag, [obj]() {
+        g_objectTag = *((size_t*)obj);
+    });
     return obj;
 }
 
@@ -1059,6 +1059,18 @@ bool Object::setIndexedProperty(ExecutionState& state, const Value& property, co
     return set(state, ObjectPropertyName(state, property), value, this);
 }
 
+void Object::getIndexedProperties(ExecutionState& state, size_t count, Value* result)
+{
+    for (size_t i = 0; i < count; i++) {
+        auto re = getIndexedProperty(state, Value(i));
+        if (re.hasValue()) {
+            result[i] = re.value(state, this);
+        } else {
+            result[i] = Value();
+        }
+    }
+}
+
 IteratorObject* Object::values(ExecutionState& state)
 {
     return new ArrayIteratorObject(state, this, ArrayIteratorObject::TypeValue);
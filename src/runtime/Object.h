@@ -522,6 +522,9 @@ class Object : public PointerValue {
     friend class GlobalObject;
     friend class ByteCodeInterpreter;
     friend struct ObjectRareData;
+    friend class ObjectTemplate;
+    friend class PropertyNameList;
+    friend class JSONFastStringifier;
     static Object* createBuiltinObjectPrototype(ExecutionState& state);
 
 public:
@@ -669,6 +672,23 @@ public:
     virtual bool deleteOwnProperty(ExecutionState& state, const ObjectPropertyName& P) ESCARGOT_OBJECT_SUBCLASS_MUST_REDEFINE;
     // callback function should skip un-Enumerable property if needs
     virtual void enumeration(ExecutionState& state, bool (*callback)(ExecutionState& state, Object* self, const ObjectPropertyName&, const ObjectStructurePropertyDescriptor& desc, void* data), void* data, bool shouldSkipSymbolKey = true) ESCARGOT_OBJECT_SUBCLASS_MUST_REDEFINE;
+    // subclass which has own properties out of its structure (elements, indexed characters, ...)
+    // or which redefines enumeration should return false
+    virtual bool canUseEnumerationCache()
+    {
+        return true;
+    }
+
+    // enumerable string keys of own properties shared by every object of same structure
+    // returns nullptr if this object cannot use the cache
+    ObjectStructureEnumerationCache* enumerationCache()
+    {
+        if (UNLIKELY(!canUseEnumerationCache())) {
+            return nullptr;
+        }
+        return m_structure->enumerationCache();
+    }
+
     virtual uint64_t length(ExecutionState& state);
     double lengthES6(ExecutionState& state);
 
@@ -726,6 +746,8 @@ public:
 
     virtual ObjectGetResult getIndexedProperty(ExecutionState& state, const Value& property);
     virtual bool setIndexedProperty(ExecutionState& state, const Value& property, const Value& value);
+    // reads [0, count) indexed properties into result (missing ones are undefined). used for spreading arguments
+    virtual void getIndexedProperties(ExecutionState& state, size_t count, Value* result);
     void setIndexedPropertyThrowsException(ExecutionState& state, const Value& property, const Value& value)
     {
         if (!setIndexedProperty(state, property, value)) {
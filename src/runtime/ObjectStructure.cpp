@@ -24,31 +24,45 @@ namespace Escargot {
 
 void* ObjectStructure::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(ObjectStructure)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructure, m_properties));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructure, m_transitionTable));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ObjectStructure));
-        typeInited = true;
-    }
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructure, m_enumerationCache));
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ObjectStructure));
+    }();
+    Heap::objectAllocationCounts().m_objectStructureCount.increase();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
 void* ObjectStructureWithFastAccess::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         const size_t len = GC_BITMAP_SIZE(ObjectStructureWithFastAccess);
         GC_word obj_bitmap[len] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithFastAccess, m_properties));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithFastAccess, m_transitionTable));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithFastAccess, m_enumerationCache));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithFastAccess, m_propertyNameMap));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ObjectStructureWithFastAccess));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ObjectStructureWithFastAccess));
+    }();
+    Heap::objectAllocationCounts().m_objectStructureCount.increase();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
+
+void ObjectStructure::buildEnumerationCache()
+{
+    ObjectStructureEnumerationCache* cache = new ObjectStructureEnumerationCache();
+    size_t cnt = m_properties.size();
+    for (size_t i = 0; i < cnt; i++) {
+        const ObjectStructureItem& item = m_properties[i];
+        if (item.m_descriptor.isEnumerable() && !item.m_propertyName.isSymbol()) {
+            cache->m_keys.pushBack(Value(item.m_propertyName.plainString()));
+            cache->m_propertyNames.pushBack(item.m_propertyName);
+            cache->m_propertyIndexes.pushBack(i);
+        }
+    }
+    cache->m_hasIndexPropertyName = m_hasIndexPropertyName;
+    m_enumerationCache = cache;
+}
 }
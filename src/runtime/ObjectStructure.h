@@ -24,6 +24,7 @@
 #include "runtime/ExecutionState.h"
 #include "runtime/PropertyName.h"
 #include "runtime/ObjectStructurePropertyDescriptor.h"
+#include "runtime/SmallValue.h"
 
 namespace Escargot {
 
@@ -58,12 +59,39 @@ typedef Vector<ObjectStructureTransitionItem, GCUtil::gc_malloc_ignore_off_page_
 
 #define ESCARGOT_OBJECT_STRUCTURE_ACCESS_CACHE_BUILD_MIN_SIZE 96
 
+// enumerable string keys of own properties in enumeration order.
+// every object of a structure shares it, so it should not be modified after it is built.
+// m_keys should be the first member because for-in holds pointer of m_keys
+struct ObjectStructureEnumerationCache : public gc {
+    enum JSONStringifyState : uint8_t {
+        JSONStringifyUnknown,
+        JSONStringifyFast,
+        JSONStringifySlow,
+    };
+
+    ObjectStructureEnumerationCache()
+        : m_hasIndexPropertyName(false)
+        , m_jsonStringifyState(JSONStringifyUnknown)
+    {
+    }
+
+    SmallValueVector m_keys;
+    Vector<PropertyName, GCUtil::gc_malloc_ignore_off_page_allocator<PropertyName>> m_propertyNames;
+    // index of each key in the structure
+    Vector<size_t, GCUtil::gc_malloc_atomic_ignore_off_page_allocator<size_t>> m_propertyIndexes;
+    // `"key":` of each key. JSON.stringify fills it when it meets the structure first
+    Vector<String*, GCUtil::gc_malloc_ignore_off_page_allocator<String*>> m_jsonQuotedKeys;
+    bool m_hasIndexPropertyName;
+    JSONStringifyState m_jsonStringifyState;
+};
+
 class ObjectStructure : public gc {
     friend class Object;
     friend class ArrayObject;
 
 public:
     ObjectStructure(ExecutionState&, bool needsTransitionTable = true)
+        : m_enumerationCache(nullptr)
     {
         m_needsTransitionTable = needsTransitionTable;
         m_isProtectedByTransitionTable = false;
@@ -73,6 +101,7 @@ public:
 
     ObjectStructure(ExecutionState&, ObjectStructureItemVector&& properties, bool needsTransitionTable, bool hasIndexPropertyName)
         : m_properties(std::move(properties))
+        , m_enumerationCache(nullptr)
     {
         m_needsTransitionTable = needsTransitionTable;
         m_isProtectedByTransitionTable = false;
@@ -126,6 +155,9 @@ public:
     ObjectStructure* removeProperty(ExecutionState& state, size_t pIndex);
     ObjectStructure* escapeTransitionMode(ExecutionState& state);
     ObjectStructure* convertToWithFastAccess(ExecutionState& state);
+    // structure with fast access is changed in place when its object adds or removes a property,
+    // so objects cannot share it. this gives a new one with same properties
+    ObjectStructure* cloneStructureWithFastAccess(ExecutionState& state);
 
     bool inTransitionMode()
     {
@@ -152,6 +184,15 @@ public:
         return m_properties.size();
     }
 
+    // every change of properties makes a new structure, so the cache never goes stale
+    ObjectStructureEnumerationCache* enumerationCache()
+    {
+        if (UNLIKELY(!m_enumerationCache)) {
+            buildEnumerationCache();
+        }
+        return m_enumerationCache;
+    }
+
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
 
@@ -164,6 +205,9 @@ protected:
     bool m_isStructureWithFastAccess;
     ObjectStructureItemVector m_properties;
     ObjectStructureTransitionTableVector m_transitionTable;
+    ObjectStructureEnumerationCache* m_enumerationCache;
+
+    void buildEnumerationCache();
 
     size_t searchTransitionTable(const PropertyName& s, const ObjectStructurePropertyDescriptor& desc)
     {
@@ -327,6 +371,13 @@ inline ObjectStructure* ObjectStructure::convertToWithFastAccess(ExecutionState&
     ObjectStructureItemVector v = m_properties;
     return new ObjectStructureWithFastAccess(state, std::move(v), m_hasIndexPropertyName);
 }
+
+inline ObjectStructure* ObjectStructure::cloneStructureWithFastAccess(ExecutionState& state)
+{
+    ASSERT(m_isStructureWithFastAccess);
+    ObjectStructureItemVector v = m_properties;
+    return new ObjectStructureWithFastAccess(state, std::move(v), m_hasIndexPropertyName);
+}
 }
 
 namespace std {
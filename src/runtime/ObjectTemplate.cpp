@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "ObjectTemplate.h"
+#include "runtime/Context.h"
+
+namespace Escargot {
+
+Object* ObjectTemplate::instantiate(ExecutionState& state)
+{
+    if (UNLIKELY(m_cachedContext != state.context())) {
+        Object* obj = new Object(state);
+        for (size_t i = 0; i < m_properties.size(); i++) {
+            const PropertyItem& item = m_properties[i];
+            ObjectPropertyName name(state, Value(item.m_name));
+            if (item.m_nativeData) {
+                if (!obj->defineNativeDataAccessorProperty(state, name, item.m_nativeData, item.m_value)) {
+                    Object::throwCannotDefineError(state, name.toPropertyName(state));
+                }
+            } else {
+                obj->defineOwnPropertyThrowsException(state, name, ObjectPropertyDescriptor(item.m_value, item.m_attribute));
+            }
+        }
+        m_cachedObject = obj;
+        m_cachedContext = state.context();
+    }
+
+    ObjectStructure* structure = m_cachedObject->m_structure;
+    size_t propertyCount = structure->propertyCount();
+    Object* obj = new Object(state, propertyCount, true);
+    if (UNLIKELY(structure->isStructureWithFastAccess())) {
+        obj->m_structure = structure->cloneStructureWithFastAccess(state);
+    } else {
+        obj->m_structure = structure;
+    }
+    for (size_t i = 0; i < propertyCount; i++) {
+        if (structure->readProperty(state, i).m_descriptor.isPlainDataProperty()) {
+            // through Value, so that a double gets its own box instead of sharing one with m_cachedObject
+            obj->m_values[i] = SmallValue(Value(m_cachedObject->m_values[i]));
+        } else {
+            obj->m_values[i] = m_cachedObject->m_values[i];
+        }
+    }
+    return obj;
+}
+}
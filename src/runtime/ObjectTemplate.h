@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotObjectTemplate__
+#define __EscargotObjectTemplate__
+
+#include "runtime/Object.h"
+
+namespace Escargot {
+
+// ObjectTemplate builds the structure and property values of its objects once (for each Context)
+// and every instance copies them instead of defining properties one by one
+class ObjectTemplate : public gc {
+public:
+    ObjectTemplate()
+        : m_cachedContext(nullptr)
+        , m_cachedObject(nullptr)
+    {
+    }
+
+    void addDataProperty(String* name, const Value& value, ObjectPropertyDescriptor::PresentAttribute attribute)
+    {
+        m_properties.pushBack(PropertyItem(name, value, nullptr, attribute));
+        m_cachedContext = nullptr;
+    }
+
+    void addNativeDataAccessorProperty(String* name, ObjectPropertyNativeGetterSetterData* data, const Value& objectInternalData)
+    {
+        m_properties.pushBack(PropertyItem(name, objectInternalData, data, ObjectPropertyDescriptor::NotPresent));
+        m_cachedContext = nullptr;
+    }
+
+    Object* instantiate(ExecutionState& state);
+
+private:
+    struct PropertyItem {
+        PropertyItem(String* name, const Value& value, ObjectPropertyNativeGetterSetterData* nativeData, ObjectPropertyDescriptor::PresentAttribute attribute)
+            : m_name(name)
+            , m_value(value)
+            , m_nativeData(nativeData)
+            , m_attribute(attribute)
+        {
+        }
+
+        String* m_name;
+        Value m_value;
+        ObjectPropertyNativeGetterSetterData* m_nativeData;
+        ObjectPropertyDescriptor::PresentAttribute m_attribute;
+    };
+
+    Vector<PropertyItem, GCUtil::gc_malloc_ignore_off_page_allocator<PropertyItem>> m_properties;
+    Context* m_cachedContext;
+    // instances copy structure and values of this object
+    Object* m_cachedObject;
+};
+}
+
+#endif
@@ -34,19 +34,20 @@ PromiseObject::PromiseObject(ExecutionState& state)
 
 void* PromiseObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(PromiseObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(PromiseObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(PromiseObject, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(PromiseObject, m_values));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(PromiseObject, m_promiseResult));
-        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(PromiseObject, m_fulfillReactions));
-        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(PromiseObject, m_rejectReactions));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(PromiseObject));
-        typeInited = true;
-    }
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(PromiseObject, m_firstReaction.m_onFulfilled));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(PromiseObject, m_firstReaction.m_onRejected));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(PromiseObject, m_firstReaction.m_capability.m_promise));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(PromiseObject, m_firstReaction.m_capability.m_resolveFunction));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(PromiseObject, m_firstReaction.m_capability.m_rejectFunction));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(PromiseObject, m_otherReactions));
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(PromiseObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
@@ -114,25 +115,31 @@ void PromiseObject::fulfillPromise(ExecutionState& state, Value value)
 {
     m_state = PromiseState::FulFilled;
     m_promiseResult = value;
-    triggerPromiseReactions(state, m_fulfillReactions);
-    m_fulfillReactions.clear();
-    m_rejectReactions.clear();
+    triggerPromiseReactions(state, true);
 }
 
 void PromiseObject::rejectPromise(ExecutionState& state, Value reason)
 {
     m_state = PromiseState::Rejected;
     m_promiseResult = reason;
-    triggerPromiseReactions(state, m_rejectReactions);
-
-    m_fulfillReactions.clear();
-    m_rejectReactions.clear();
+    triggerPromiseReactions(state, false);
 }
 
-void PromiseObject::triggerPromiseReactions(ExecutionState& state, PromiseObject::Reactions& reactions)
+void PromiseObject::triggerPromiseReactions(ExecutionState& state, bool isFulfilled)
 {
-    for (size_t i = 0; i < reactions.size(); i++)
-        state.context()->jobQueue()->enqueueJob(state, new PromiseReactionJob(state.context(), reactions[i], m_promiseResult));
+    if (!m_firstReaction.m_onFulfilled) {
+        return;
+    }
+
+    PromiseReactionRecord first = m_firstReaction;
+    Reactions others = std::move(m_otherReactions);
+    m_firstReaction = PromiseReactionRecord();
+
+    DefaultJobQueue* jobQueue = DefaultJobQueue::get(state.context()->jobQueue());
+    jobQueue->enqueueJob(state, jobQueue->createPromiseReactionJob(state.context(), PromiseReaction(isFulfilled ? first.m_onFulfilled : first.m_onRejected, first.m_capability), m_promiseResult));
+    for (size_t i = 0; i < others.size(); i++) {
+        jobQueue->enqueueJob(state, jobQueue->createPromiseReactionJob(state.context(), PromiseReaction(isFulfilled ? others[i].m_onFulfilled : others[i].m_onRejected, others[i].m_capability), m_promiseResult));
+    }
 }
 }
 
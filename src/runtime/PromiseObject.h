@@ -73,6 +73,26 @@ public:
     FunctionObject* m_handler;
 };
 
+// reaction pair registered by then() while promise is pending
+struct PromiseReactionRecord {
+    PromiseReactionRecord()
+        : m_onFulfilled(nullptr)
+        , m_onRejected(nullptr)
+    {
+    }
+
+    PromiseReactionRecord(FunctionObject* onFulfilled, FunctionObject* onRejected, const PromiseReaction::Capability& capability)
+        : m_onFulfilled(onFulfilled)
+        , m_onRejected(onRejected)
+        , m_capability(capability)
+    {
+    }
+
+    FunctionObject* m_onFulfilled;
+    FunctionObject* m_onRejected;
+    PromiseReaction::Capability m_capability;
+};
+
 class PromiseObject : public Object {
 public:
     enum PromiseState {
@@ -97,13 +117,17 @@ public:
     void fulfillPromise(ExecutionState& state, Value value);
     void rejectPromise(ExecutionState& state, Value reason);
 
-    typedef Vector<PromiseReaction, gc_allocator_ignore_off_page<PromiseReaction> > Reactions;
-    void triggerPromiseReactions(ExecutionState& state, Reactions& reactions);
+    typedef Vector<PromiseReactionRecord, gc_allocator_ignore_off_page<PromiseReactionRecord> > Reactions;
+    void triggerPromiseReactions(ExecutionState& state, bool isFulfilled);
 
+    // most promises have only one reaction, so the first one is stored in the object
     void appendReaction(FunctionObject* onFulfilled, FunctionObject* onRejected, PromiseReaction::Capability& capability)
     {
-        m_fulfillReactions.push_back(PromiseReaction(onFulfilled, capability));
-        m_rejectReactions.push_back(PromiseReaction(onRejected, capability));
+        if (!m_firstReaction.m_onFulfilled) {
+            m_firstReaction = PromiseReactionRecord(onFulfilled, onRejected, capability);
+        } else {
+            m_otherReactions.push_back(PromiseReactionRecord(onFulfilled, onRejected, capability));
+        }
     }
 
     PromiseReaction::Capability createResolvingFunctions(ExecutionState& state);
@@ -124,8 +148,8 @@ public:
 private:
     PromiseState m_state;
     Value m_promiseResult;
-    Reactions m_fulfillReactions;
-    Reactions m_rejectReactions;
+    PromiseReactionRecord m_firstReaction;
+    Reactions m_otherReactions;
 
 protected:
 };
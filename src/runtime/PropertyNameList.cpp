@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "PropertyNameList.h"
+
+namespace Escargot {
+
+void PropertyNameList::updateCache(ExecutionState& state, Object* obj)
+{
+    ObjectStructure* structure = obj->structure();
+    if (LIKELY(m_cachedStructure == structure)) {
+        return;
+    }
+
+    // exotic objects can have own properties which are not in structure
+    bool canUseStructure = obj->hasTag(g_objectTag);
+    for (size_t i = 0; i < m_names.size(); i++) {
+        size_t idx = canUseStructure ? structure->findProperty(m_names[i]) : SIZE_MAX;
+        if (idx != SIZE_MAX && !structure->readProperty(state, idx).m_descriptor.isDataProperty()) {
+            idx = SIZE_MAX;
+        }
+        m_cachedIndexes[i] = idx;
+    }
+    m_cachedStructure = structure;
+}
+
+void PropertyNameList::get(ExecutionState& state, Object* obj, Value* values)
+{
+    updateCache(state, obj);
+    for (size_t i = 0; i < m_names.size(); i++) {
+        size_t idx = m_cachedIndexes[i];
+        if (LIKELY(idx != SIZE_MAX)) {
+            values[i] = obj->getOwnDataPropertyUtilForObject(state, idx, obj);
+        } else {
+            values[i] = obj->get(state, ObjectPropertyName(state, m_names[i])).value(state, obj);
+        }
+        // getter can change structure of obj
+        updateCache(state, obj);
+    }
+}
+
+bool PropertyNameList::set(ExecutionState& state, Object* obj, const Value* values)
+{
+    bool result = true;
+    updateCache(state, obj);
+    for (size_t i = 0; i < m_names.size(); i++) {
+        size_t idx = m_cachedIndexes[i];
+        if (LIKELY(idx != SIZE_MAX)) {
+            result &= obj->setOwnDataPropertyUtilForObject(state, idx, values[i]);
+        } else {
+            result &= obj->set(state, ObjectPropertyName(state, m_names[i]), values[i], obj);
+        }
+        // setter or adding a property can change structure of obj
+        updateCache(state, obj);
+    }
+    return result;
+}
+
+size_t PropertyNameList::getOwnEnumerableDataProperties(ExecutionState& state, Object* obj, Value* keys, Value* values, size_t bufferSize)
+{
+    if (LIKELY(obj->hasTag(g_objectTag))) {
+        // native accessors can run embedder code that changes structure of obj,
+        // so the structure is walked directly only if it has plain data properties
+        ObjectStructure* structure = obj->structure();
+        size_t propertyCount = structure->propertyCount();
+        bool canUseStructure = true;
+        for (size_t i = 0; i < propertyCount; i++) {
+            const ObjectStructurePropertyDescriptor& desc = structure->readProperty(state, i).m_descriptor;
+            if (!desc.isDataProperty() || !desc.isPlainDataProperty()) {
+                canUseStructure = false;
+                break;
+            }
+        }
+
+        if (canUseStructure) {
+            size_t count = 0;
+            for (size_t i = 0; i < propertyCount; i++) {
+                const ObjectStructureItem& item = structure->readProperty(state, i);
+                if (item.m_descriptor.isEnumerable() && !item.m_propertyName.isSymbol()) {
+                    if (count < bufferSize) {
+                        keys[count] = item.m_propertyName.toValue();
+                        values[count] = obj->m_values[i];
+                    }
+                    count++;
+                }
+            }
+            return count;
+        }
+    }
+
+    struct Data {
+        Value* keys;
+        Value* values;
+        size_t bufferSize;
+        size_t count;
+    } data = { keys, values, bufferSize, 0 };
+
+    obj->enumeration(state, [](ExecutionState& state, Object* self, const ObjectPropertyName& name, const ObjectStructurePropertyDescriptor& desc, void* cbData) -> bool {
+        Data* data = (Data*)cbData;
+        if (desc.isEnumerable() && desc.isDataProperty()) {
+            if (data->count < data->bufferSize) {
+                data->keys[data->count] = name.toPlainValue(state);
+                data->values[data->count] = self->getOwnProperty(state, name).value(state, self);
+            }
+            data->count++;
+        }
+        return true;
+    },
+                     &data);
+    return data.count;
+}
+}
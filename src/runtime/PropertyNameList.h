@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotPropertyNameList__
+#define __EscargotPropertyNameList__
+
+#include "runtime/Object.h"
+
+namespace Escargot {
+
+// list of property names for reading or writing many properties of an object at once.
+// like inline caches, it keeps slot index of each name for the last ObjectStructure it met,
+// so objects of the same structure are accessed without looking up structure again.
+// names which are not own data properties go through Object::get / Object::set
+class PropertyNameList : public gc {
+public:
+    PropertyNameList(const AtomicString* names, size_t count)
+        : m_cachedStructure(nullptr)
+    {
+        for (size_t i = 0; i < count; i++) {
+            m_names.pushBack(PropertyName(names[i]));
+        }
+        m_cachedIndexes.resizeWithUninitializedValues(count);
+    }
+
+    size_t size() const
+    {
+        return m_names.size();
+    }
+
+    void get(ExecutionState& state, Object* obj, Value* values);
+    // returns false if any of names could not be set
+    bool set(ExecutionState& state, Object* obj, const Value* values);
+
+    // fills own enumerable data properties of obj into keys, values (up to bufferSize) and returns number of them
+    static size_t getOwnEnumerableDataProperties(ExecutionState& state, Object* obj, Value* keys, Value* values, size_t bufferSize);
+
+private:
+    void updateCache(ExecutionState& state, Object* obj);
+
+    Vector<PropertyName, GCUtil::gc_malloc_ignore_off_page_allocator<PropertyName>> m_names;
+    Vector<size_t, GCUtil::gc_malloc_atomic_ignore_off_page_allocator<size_t>> m_cachedIndexes;
+    ObjectStructure* m_cachedStructure;
+};
+}
+
+#endif
@@ -38,18 +38,15 @@ ProxyObject::ProxyObject(ExecutionState& state)
 
 void* ProxyObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(ProxyObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ProxyObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ProxyObject, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ProxyObject, m_values));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ProxyObject, m_target));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ProxyObject, m_handler));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ProxyObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ProxyObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
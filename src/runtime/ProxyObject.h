@@ -66,6 +66,11 @@ public:
         return false;
     }
 
+    virtual bool canUseEnumerationCache()
+    {
+        return false;
+    }
+
     virtual bool isCallable() const
     {
         return m_isCallable;
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "RandomGenerator.h"
+
+#if defined(OS_POSIX)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Escargot {
+
+static uint64_t secureRandomSeed()
+{
+    uint64_t seed = 0;
+#if defined(OS_POSIX)
+    int fd = open("/dev/urandom", O_RDONLY);
+    if (fd >= 0) {
+        ssize_t readSize = read(fd, &seed, sizeof(seed));
+        close(fd);
+        if (readSize == sizeof(seed)) {
+            return seed;
+        }
+    }
+#endif
+    // mix time with addresses which differ in each process when there is no random device
+    seed = (uint64_t)time(nullptr);
+    seed ^= (uint64_t)(size_t)&seed << 16;
+    seed ^= (uint64_t)(size_t)&secureRandomSeed;
+    return seed;
+}
+
+RandomGenerator::RandomGenerator()
+{
+    seed(secureRandomSeed());
+}
+
+// expands 64-bit seed into the state with splitmix64, so that similar seeds give unrelated sequences
+void RandomGenerator::seed(uint64_t seed)
+{
+    uint64_t state[2];
+    for (size_t i = 0; i < 2; i++) {
+        seed += 0x9E3779B97F4A7C15ULL;
+        uint64_t z = seed;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        state[i] = z ^ (z >> 31);
+    }
+    // state must not be all zero
+    if (!state[0] && !state[1]) {
+        state[0] = 1;
+    }
+    m_state0 = state[0];
+    m_state1 = state[1];
+    m_bufferPosition = BufferSize;
+}
+
+void RandomGenerator::refill()
+{
+    uint64_t s0 = m_state0;
+    uint64_t s1 = m_state1;
+    for (size_t i = 0; i < BufferSize; i++) {
+        uint64_t x = s0;
+        uint64_t y = s1;
+        uint64_t result = x + y;
+        s0 = y;
+        x ^= x << 23;
+        s1 = x ^ y ^ (x >> 17) ^ (y >> 26);
+        // upper 53 bits are the best bits of xorshift128+
+        m_buffer[i] = (double)(result >> 11) * (1.0 / 9007199254740992.0);
+    }
+    m_state0 = s0;
+    m_state1 = s1;
+    m_bufferPosition = 0;
+}
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotRandomGenerator__
+#define __EscargotRandomGenerator__
+
+namespace Escargot {
+
+// xorshift128+ generator for Math.random. each Context has its own one, so it needs no lock.
+// numbers are made in batches, so a call usually reads only one buffered double
+class RandomGenerator {
+public:
+    // seeded from a secure source of the platform
+    RandomGenerator();
+
+    // same seed gives same sequence of numbers
+    void seed(uint64_t seed);
+
+    // returns a number in [0, 1)
+    double nextDouble()
+    {
+        if (UNLIKELY(m_bufferPosition == BufferSize)) {
+            refill();
+        }
+        return m_buffer[m_bufferPosition++];
+    }
+
+private:
+    enum { BufferSize = 64 };
+
+    void refill();
+
+    uint64_t m_state0;
+    uint64_t m_state1;
+    size_t m_bufferPosition;
+    double m_buffer[BufferSize];
+};
+}
+
+#endif
@@ -63,9 +63,7 @@ void RegExpObject::initRegExpObject(ExecutionState& state)
 
 void* RegExpObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(RegExpObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RegExpObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RegExpObject, m_prototype));
@@ -75,9 +73,8 @@ void* RegExpObject::operator new(size_t size)
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RegExpObject, m_bytecodePattern));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RegExpObject, m_lastIndex));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RegExpObject, m_lastExecutedString));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(RegExpObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(RegExpObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
@@ -440,7 +437,7 @@ ArrayObject* RegExpObject::createMatchedArray(ExecutionState& state, String* str
     size_t len = result.m_matchResults.size();
     ret->setThrowsException(state, state.context()->staticStrings().length, Value(len), ret);
     for (size_t idx = 0; idx < len; idx++) {
-        ret->defineOwnProperty(state, ObjectPropertyName(state, Value(idx)), ObjectPropertyDescriptor(Value(new StringView(str, result.m_matchResults[idx][0].m_start, result.m_matchResults[idx][0].m_end)), ObjectPropertyDescriptor::AllPresent));
+        ret->defineOwnProperty(state, ObjectPropertyName(state, Value(idx)), ObjectPropertyDescriptor(Value(str->substring(result.m_matchResults[idx][0].m_start, result.m_matchResults[idx][0].m_end)), ObjectPropertyDescriptor::AllPresent));
     }
     return ret;
 }
@@ -458,7 +455,7 @@ ArrayObject* RegExpObject::createRegExpMatchedArray(ExecutionState& state, const
             if (result.m_matchResults[i][j].m_start == std::numeric_limits<unsigned>::max()) {
                 arr->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(idx++)), ObjectPropertyDescriptor(Value(), ObjectPropertyDescriptor::AllPresent));
             } else {
-                arr->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(idx++)), ObjectPropertyDescriptor(Value(new StringView(input, result.m_matchResults[i][j].m_start, result.m_matchResults[i][j].m_end)), ObjectPropertyDescriptor::AllPresent));
+                arr->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(idx++)), ObjectPropertyDescriptor(Value(input->substring(result.m_matchResults[i][j].m_start, result.m_matchResults[i][j].m_end)), ObjectPropertyDescriptor::AllPresent));
             }
         }
     }
@@ -26,15 +26,13 @@ namespace Escargot {
 
 void* RopeString::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(RopeString)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RopeString, m_left));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(RopeString, m_right));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(RopeString));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(RopeString));
+    }();
+    Heap::objectAllocationCounts().m_stringCount.increase();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
@@ -80,21 +78,8 @@ String* RopeString::createRopeString(String* lstr, String* rstr, ExecutionState*
     rope->m_left = lstr;
     rope->m_right = rstr;
 
-    bool l8bit;
-    if (lstr->isRopeString()) {
-        l8bit = ((RopeString*)lstr)->m_has8BitContent;
-    } else {
-        l8bit = lstr->has8BitContent();
-    }
-
-    bool r8bit;
-    if (rstr->isRopeString()) {
-        r8bit = ((RopeString*)rstr)->m_has8BitContent;
-    } else {
-        r8bit = rstr->has8BitContent();
-    }
-
-    rope->m_has8BitContent = l8bit & r8bit;
+    rope->m_has8BitContent = has8BitContentOf(lstr) & has8BitContentOf(rstr);
+    rope->m_depth = std::min(std::max(depthOf(lstr), depthOf(rstr)) + 1, 255);
     /*
     bool has8 = true;
     if (!lstr->has8BitContent()) {
@@ -169,8 +154,195 @@ void RopeString::flattenRopeString()
     }
 }
 
+char16_t RopeString::charAt(const size_t& idx) const
+{
+    RopeString* self = const_cast<RopeString*>(this);
+    if (!m_right || m_charAtCount >= MaxCharAtTraversalCount) {
+        return normalString()->charAt(idx);
+    }
+    self->m_charAtCount++;
+    self->balanceIfNeeded();
+
+    String* cur = self;
+    size_t i = idx;
+    while (isUnflattenedRope(cur)) {
+        RopeString* rope = (RopeString*)cur;
+        size_t leftLength = rope->m_left->length();
+        if (i < leftLength) {
+            cur = rope->m_left;
+        } else {
+            i -= leftLength;
+            cur = rope->m_right;
+        }
+    }
+    return cur->charAt(i);
+}
+
+UTF16StringData RopeString::toUTF16StringData() const
+{
+    UTF16StringData ret;
+    ret.resizeWithUninitializedValues(length());
+    char16_t* dst = ret.data();
+    forEachPiece(const_cast<RopeString*>(this), 0, length(), [&dst](const StringBufferAccessData& data, size_t from, size_t to) -> bool {
+        if (data.has8BitContent) {
+            const LChar* src = (const LChar*)data.buffer;
+            for (size_t i = from; i < to; i++) {
+                *dst++ = src[i];
+            }
+        } else {
+            memcpy(dst, (const char16_t*)data.buffer + from, (to - from) * sizeof(char16_t));
+            dst += to - from;
+        }
+        return true;
+    });
+    return ret;
+}
+
+template <typename OutputType>
+static void appendAsUTF8(OutputType& output, char32_t ch)
+{
+    if (ch < 0x80) {
+        char c = ch;
+        output.append(&c, 1);
+    } else {
+        char buf[8];
+        auto len = utf32ToUtf8(ch, buf);
+        output.append(buf, len);
+    }
+}
+
+// pieces can split a surrogate pair, so lead surrogate is carried to next piece
+template <typename OutputType>
+OutputType RopeString::toUTF8String() const
+{
+    OutputType ret;
+    char16_t lead = 0;
+    forEachPiece(const_cast<RopeString*>(this), 0, length(), [&ret, &lead](const StringBufferAccessData& data, size_t from, size_t to) -> bool {
+        for (size_t i = from; i < to; i++) {
+            char16_t ch = data.charAt(i);
+            if (lead) {
+                if (U16_IS_TRAIL(ch)) {
+                    appendAsUTF8(ret, U16_GET_SUPPLEMENTARY(lead, ch));
+                    lead = 0;
+                    continue;
+                }
+                appendAsUTF8(ret, 0xFFFD);
+                lead = 0;
+            }
+            if (U16_IS_LEAD(ch)) {
+                lead = ch;
+            } else {
+                appendAsUTF8(ret, ch);
+            }
+        }
+        return true;
+    });
+    if (lead) {
+        appendAsUTF8(ret, lead);
+    }
+    return ret;
+}
+
+UTF8StringData RopeString::toUTF8StringData() const
+{
+    return toUTF8String<UTF8StringData>();
+}
+
 UTF8StringDataNonGCStd RopeString::toNonGCUTF8StringData() const
 {
-    return normalString()->toNonGCUTF8StringData();
+    return toUTF8String<UTF8StringDataNonGCStd>();
+}
+
+size_t RopeString::hashValueSpecialImpl() const
+{
+    size_t hash = String::stringHashSeed;
+    forEachPiece(const_cast<RopeString*>(this), 0, length(), [&hash](const StringBufferAccessData& data, size_t from, size_t to) -> bool {
+        if (data.has8BitContent) {
+            hash = stringHash((const LChar*)data.buffer + from, to - from, hash);
+        } else {
+            hash = stringHash((const char16_t*)data.buffer + from, to - from, hash);
+        }
+        return true;
+    });
+    return adjustHashValue(hash);
+}
+
+void RopeString::balance()
+{
+    ASSERT(m_right);
+
+    // collect leaves in order. rope can be very deep here, so it is done without recursion
+    std::vector<String*, GCUtil::gc_malloc_ignore_off_page_allocator<String*>> leaves;
+    std::vector<String*> stack;
+    stack.push_back(m_right);
+    stack.push_back(m_left);
+    while (!stack.empty()) {
+        String* cur = stack.back();
+        stack.pop_back();
+        if (isUnflattenedRope(cur)) {
+            stack.push_back(((RopeString*)cur)->m_right);
+            stack.push_back(((RopeString*)cur)->m_left);
+        } else {
+            leaves.push_back(cur);
+        }
+    }
+
+    // merge adjacent short leaves, so pieces are not too many
+    std::vector<String*, GCUtil::gc_malloc_ignore_off_page_allocator<String*>> pieces;
+    size_t runStart = 0;
+    size_t runLength = 0;
+    auto flushRun = [&](size_t runEnd) {
+        if (runEnd == runStart) {
+            return;
+        }
+        if (runEnd - runStart == 1) {
+            pieces.push_back(leaves[runStart]);
+            return;
+        }
+        StringBuilder builder;
+        for (size_t i = runStart; i < runEnd; i++) {
+            builder.appendString(leaves[i]);
+        }
+        pieces.push_back(builder.finalize());
+    };
+    for (size_t i = 0; i < leaves.size(); i++) {
+        size_t leafLength = leaves[i]->length();
+        if (runLength && runLength + leafLength > BalancedPieceLength) {
+            flushRun(i);
+            runStart = i;
+            runLength = 0;
+        }
+        runLength += leafLength;
+    }
+    flushRun(leaves.size());
+
+    if (pieces.size() == 1) {
+        m_left = pieces[0];
+        m_right = nullptr;
+        return;
+    }
+
+    std::function<String*(size_t, size_t)> build = [&](size_t from, size_t to) -> String* {
+        if (to - from == 1) {
+            return pieces[from];
+        }
+        size_t mid = from + (to - from) / 2;
+        String* left = build(from, mid);
+        String* right = build(mid, to);
+        RopeString* rope = new RopeString();
+        rope->m_left = left;
+        rope->m_right = right;
+        rope->m_contentLength = left->length() + right->length();
+        rope->m_has8BitContent = has8BitContentOf(left) && has8BitContentOf(right);
+        rope->m_depth = std::max(depthOf(left), depthOf(right)) + 1;
+        return rope;
+    };
+
+    size_t mid = pieces.size() / 2;
+    String* left = build(0, mid);
+    String* right = build(mid, pieces.size());
+    m_left = left;
+    m_right = right;
+    m_depth = std::max(depthOf(left), depthOf(right)) + 1;
 }
 }
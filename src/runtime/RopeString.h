@@ -35,6 +35,8 @@ public:
         m_right = String::emptyString;
         m_contentLength = 0;
         m_has8BitContent = true;
+        m_depth = 0;
+        m_charAtCount = 0;
         m_bufferAccessData.hasSpecialImpl = true;
     }
 
@@ -48,20 +50,12 @@ public:
     {
         return m_contentLength;
     }
-    virtual char16_t charAt(const size_t& idx) const
-    {
-        return normalString()->charAt(idx);
-    }
-    virtual UTF16StringData toUTF16StringData() const
-    {
-        return normalString()->toUTF16StringData();
-    }
-    virtual UTF8StringData toUTF8StringData() const
-    {
-        return normalString()->toUTF8StringData();
-    }
-
+    // operations below walk the rope instead of flattening it
+    virtual char16_t charAt(const size_t& idx) const;
+    virtual UTF16StringData toUTF16StringData() const;
+    virtual UTF8StringData toUTF8StringData() const;
     virtual UTF8StringDataNonGCStd toNonGCUTF8StringData() const;
+    virtual size_t hashValueSpecialImpl() const;
 
     virtual bool isRopeString()
     {
@@ -86,6 +80,74 @@ public:
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
 
+    // calls fn(const StringBufferAccessData& data, size_t from, size_t to) for each flat piece of
+    // [start, end) of str in order. [from, to) is range in the piece. visiting stops when fn returns false.
+    // str can be any string, and rope is not flattened
+    template <typename Fn>
+    static bool forEachPiece(String* str, size_t start, size_t end, const Fn& fn)
+    {
+        if (start >= end) {
+            return true;
+        }
+
+        if (!isUnflattenedRope(str)) {
+            const auto& data = str->bufferAccessData();
+            return fn(data, start, end);
+        }
+
+        // walking down to the middle of deep rope is as slow as visiting all pieces
+        if (start || end != str->length()) {
+            ((RopeString*)str)->balanceIfNeeded();
+        }
+
+        struct Item {
+            String* m_string;
+            size_t m_offset;
+        };
+        // stack holds at most one item per level of rope, so balanced rope fits in inlineStack.
+        // items which don't fit go to overflowStack (only deep ropes walked as a whole)
+        Item inlineStack[InlineTraversalStackSize];
+        size_t inlineStackSize = 0;
+        std::vector<Item, GCUtil::gc_malloc_ignore_off_page_allocator<Item>> overflowStack;
+        auto push = [&](const Item& item) {
+            if (LIKELY(inlineStackSize < InlineTraversalStackSize)) {
+                inlineStack[inlineStackSize++] = item;
+            } else {
+                overflowStack.push_back(item);
+            }
+        };
+
+        push(Item{ str, 0 });
+        while (inlineStackSize) {
+            Item item;
+            if (UNLIKELY(!overflowStack.empty())) {
+                item = overflowStack.back();
+                overflowStack.pop_back();
+            } else {
+                item = inlineStack[--inlineStackSize];
+            }
+            if (isUnflattenedRope(item.m_string)) {
+                RopeString* rope = (RopeString*)item.m_string;
+                size_t rightOffset = item.m_offset + rope->m_left->length();
+                if (end > rightOffset) {
+                    push(Item{ rope->m_right, rightOffset });
+                }
+                if (start < rightOffset) {
+                    push(Item{ rope->m_left, item.m_offset });
+                }
+                continue;
+            }
+
+            const auto& data = item.m_string->bufferAccessData();
+            size_t from = start > item.m_offset ? start - item.m_offset : 0;
+            size_t to = std::min(end - item.m_offset, data.length);
+            if (!fn(data, from, to)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
 protected:
     String* normalString() const
     {
@@ -97,7 +159,50 @@ protected:
     void flattenRopeStringWorker();
     void flattenRopeString();
 
+    static bool isUnflattenedRope(String* str)
+    {
+        return str->isRopeString() && ((RopeString*)str)->m_right;
+    }
+
+    // rope knows it without flattening
+    static bool has8BitContentOf(String* str)
+    {
+        if (str->isRopeString()) {
+            return ((RopeString*)str)->m_has8BitContent;
+        }
+        return str->has8BitContent();
+    }
+
+    static uint8_t depthOf(String* str)
+    {
+        return isUnflattenedRope(str) ? ((RopeString*)str)->m_depth : 0;
+    }
+
+    void balanceIfNeeded()
+    {
+        if (UNLIKELY(m_right && m_depth > MaxTraversalDepth)) {
+            balance();
+        }
+    }
+    void balance();
+
+    template <typename OutputType>
+    OutputType toUTF8String() const;
+
 private:
+    // strings built by repeated concatenation are deep ropes leaning to left.
+    // before walking down a rope deeper than MaxTraversalDepth, we rebuild it as balanced tree
+    // whose leaves are merged up to BalancedPieceLength.
+    // charAt walks the rope only for first MaxCharAtTraversalCount calls, because
+    // a caller reading many characters one by one is faster on flat string
+    enum {
+        MaxTraversalDepth = 32,
+        BalancedPieceLength = 1024,
+        MaxCharAtTraversalCount = 32,
+        InlineTraversalStackSize = MaxTraversalDepth * 2,
+    };
+
+
     String* m_left;
     String* m_right;
     struct {
@@ -108,6 +213,8 @@ private:
         size_t m_contentLength : 63;
 #endif
     };
+    uint8_t m_depth;
+    uint8_t m_charAtCount;
 #if !defined(COMPILER_MSVC)
     static_assert(STRING_MAXIMUM_LENGTH < (std::numeric_limits<size_t>::max() / 2), "");
 #endif
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "SamplingProfiler.h"
+#include "runtime/Context.h"
+#include "runtime/VMInstance.h"
+#include "runtime/ExecutionState.h"
+#include "runtime/ExecutionContext.h"
+#include "runtime/Environment.h"
+#include "runtime/EnvironmentRecord.h"
+#include "runtime/FunctionObject.h"
+#include "interpreter/ByteCode.h"
+#include "parser/CodeBlock.h"
+#include "parser/Script.h"
+
+#if defined(OS_POSIX)
+#include <signal.h>
+#include <sys/time.h>
+#endif
+
+namespace Escargot {
+
+SamplingProfiler* SamplingProfiler::s_runningProfiler;
+volatile bool SamplingProfiler::s_sampleRequested;
+
+#if defined(OS_POSIX)
+static struct sigaction s_oldProfilingSignalAction;
+
+static void profilingSignalHandler(int)
+{
+    SamplingProfiler::requestSample();
+}
+#endif
+
+SamplingProfiler::SamplingProfiler(VMInstance* instance)
+    : m_vmInstance(instance)
+{
+}
+
+bool SamplingProfiler::start(size_t intervalInMicroseconds)
+{
+    if (s_runningProfiler) {
+        return s_runningProfiler == this;
+    }
+
+#if defined(OS_POSIX)
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = profilingSignalHandler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, &s_oldProfilingSignalAction) != 0) {
+        return false;
+    }
+
+    intervalInMicroseconds = std::max(intervalInMicroseconds, (size_t)1);
+    struct itimerval timer;
+    timer.it_interval.tv_sec = intervalInMicroseconds / 1000000;
+    timer.it_interval.tv_usec = intervalInMicroseconds % 1000000;
+    timer.it_value = timer.it_interval;
+
+    m_samples.clear();
+    m_frames.clear();
+    s_sampleRequested = false;
+    s_runningProfiler = this;
+
+    if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+        s_runningProfiler = nullptr;
+        sigaction(SIGPROF, &s_oldProfilingSignalAction, nullptr);
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void SamplingProfiler::stop()
+{
+    if (!isRunning()) {
+        return;
+    }
+
+#if defined(OS_POSIX)
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_PROF, &timer, nullptr);
+    sigaction(SIGPROF, &s_oldProfilingSignalAction, nullptr);
+#endif
+
+    s_runningProfiler = nullptr;
+    s_sampleRequested = false;
+}
+
+NEVER_INLINE void SamplingProfiler::takeSample(ExecutionState& state, ByteCodeBlock* byteCodeBlock, size_t byteCodePosition)
+{
+    SamplingProfiler* profiler = s_runningProfiler;
+    if (!profiler) {
+        s_sampleRequested = false;
+        return;
+    }
+
+    // leave the request for the thread running profiled VMInstance
+    if (profiler->m_vmInstance != state.context()->vmInstance()) {
+        return;
+    }
+
+    s_sampleRequested = false;
+    profiler->recordSample(state, byteCodeBlock, byteCodePosition);
+}
+
+// returns record of function (or global code) which owns the state
+// inner scopes like block or catch have their own ExecutionState, but share this record
+static EnvironmentRecord* functionRecordOf(ExecutionState* state)
+{
+    ExecutionContext* ec = state->executionContext();
+    if (!ec) {
+        return nullptr;
+    }
+
+    LexicalEnvironment* env = ec->lexicalEnvironment();
+    while (env) {
+        EnvironmentRecord* record = env->record();
+        if (record->isGlobalEnvironmentRecord()) {
+            return record;
+        } else if (record->isDeclarativeEnvironmentRecord() && record->asDeclarativeEnvironmentRecord()->isFunctionEnvironmentRecord()) {
+            return record;
+        }
+        env = env->outerEnvironment();
+    }
+    return nullptr;
+}
+
+void SamplingProfiler::recordSample(ExecutionState& state, ByteCodeBlock* byteCodeBlock, size_t byteCodePosition)
+{
+    Sample sample;
+    sample.m_byteCodeBlock = byteCodeBlock;
+    sample.m_byteCodePosition = byteCodePosition;
+    sample.m_frameStart = m_frames.size();
+
+    EnvironmentRecord* lastRecord = functionRecordOf(&state);
+    size_t depth = 0;
+    for (ExecutionState* s = state.parent(); s && depth < MaxStackDepth; s = s->parent()) {
+        EnvironmentRecord* record = functionRecordOf(s);
+        if (!record || record == lastRecord) {
+            continue;
+        }
+        lastRecord = record;
+
+        if (record->isGlobalEnvironmentRecord()) {
+            m_frames.pushBack(record->asGlobalEnvironmentRecord()->globalCodeBlock());
+        } else {
+            m_frames.pushBack(record->asDeclarativeEnvironmentRecord()->asFunctionEnvironmentRecord()->functionObject()->codeBlock());
+        }
+        depth++;
+    }
+
+    sample.m_frameCount = depth;
+    m_samples.pushBack(sample);
+}
+
+static void appendFrameName(std::string& output, CodeBlock* codeBlock, size_t line)
+{
+    if (!codeBlock->isInterpretedCodeBlock()) {
+        auto name = codeBlock->functionName().string()->toUTF8StringData();
+        output.append(name.data(), name.length());
+        output.append(" [native]");
+        return;
+    }
+
+    InterpretedCodeBlock* blk = codeBlock->asInterpretedCodeBlock();
+    if (blk->isGlobalScopeCodeBlock()) {
+        output.append("(program)");
+    } else if (blk->functionName().string()->length()) {
+        auto name = blk->functionName().string()->toUTF8StringData();
+        output.append(name.data(), name.length());
+    } else {
+        output.append("(anonymous)");
+    }
+
+    output.append(" (");
+    auto fileName = blk->script()->fileName()->toUTF8StringData();
+    output.append(fileName.data(), fileName.length());
+    output.push_back(':');
+    output.append(std::to_string(line));
+    output.push_back(')');
+}
+
+std::string SamplingProfiler::collapsedStacks()
+{
+    std::map<std::pair<ByteCodeBlock*, size_t>, size_t> lineCache;
+    std::map<std::string, size_t> stackCounts;
+
+    std::string stack;
+    for (size_t i = 0; i < m_samples.size(); i++) {
+        const Sample& sample = m_samples[i];
+        stack.clear();
+
+        for (size_t j = sample.m_frameCount; j > 0; j--) {
+            CodeBlock* codeBlock = m_frames[sample.m_frameStart + j - 1];
+            size_t line = codeBlock->isInterpretedCodeBlock() ? codeBlock->asInterpretedCodeBlock()->sourceElementStart().line : 0;
+            appendFrameName(stack, codeBlock, line);
+            stack.push_back(';');
+        }
+
+        auto key = std::make_pair(sample.m_byteCodeBlock, sample.m_byteCodePosition);
+        auto iter = lineCache.find(key);
+        if (iter == lineCache.end()) {
+            InterpretedCodeBlock* codeBlock = sample.m_byteCodeBlock->m_codeBlock;
+            ExtendedNodeLOC loc = sample.m_byteCodeBlock->computeNodeLOCFromByteCode(codeBlock->context(), sample.m_byteCodePosition, codeBlock);
+            size_t line = loc.index == SIZE_MAX ? codeBlock->sourceElementStart().line : loc.line;
+            iter = lineCache.insert(std::make_pair(key, line)).first;
+        }
+        appendFrameName(stack, sample.m_byteCodeBlock->m_codeBlock, iter->second);
+
+        stackCounts[stack]++;
+    }
+
+    std::string result;
+    for (auto& item : stackCounts) {
+        result.append(item.first);
+        result.push_back(' ');
+        result.append(std::to_string(item.second));
+        result.push_back('\n');
+    }
+    return result;
+}
+}
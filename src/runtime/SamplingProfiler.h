@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotSamplingProfiler__
+#define __EscargotSamplingProfiler__
+
+#include "util/Vector.h"
+
+namespace Escargot {
+
+class VMInstance;
+class ExecutionState;
+class ByteCodeBlock;
+class CodeBlock;
+
+// timer signal only sets a flag, and interpreter takes a sample when it meets the flag
+// on function entry or on a backward jump, so time spent in native code is charged
+// to the next safepoint of javascript code.
+// the timer is process-wide, so only one VMInstance can be profiled at a time
+class SamplingProfiler : public gc {
+public:
+    explicit SamplingProfiler(VMInstance* instance);
+
+    // returns false if another profiler is running or the platform has no profiling timer
+    bool start(size_t intervalInMicroseconds);
+    void stop();
+
+    bool isRunning()
+    {
+        return s_runningProfiler == this;
+    }
+
+    size_t sampleCount()
+    {
+        return m_samples.size();
+    }
+
+    // one line per distinct stack in "outermost;...;innermost count" form.
+    // it can be fed into flamegraph.pl directly
+    std::string collapsedStacks();
+
+    static bool isSampleRequested()
+    {
+        return s_sampleRequested;
+    }
+
+    // called from signal handler, so it should not do anything more than this
+    static void requestSample()
+    {
+        s_sampleRequested = true;
+    }
+
+    static void takeSample(ExecutionState& state, ByteCodeBlock* byteCodeBlock, size_t byteCodePosition);
+
+private:
+    enum { MaxStackDepth = 256 };
+
+    // innermost frame is resolved to its line lazily, because finding line of bytecode is slow.
+    // outer frames are recorded as functions only since we don't know their bytecode position
+    struct Sample {
+        ByteCodeBlock* m_byteCodeBlock;
+        size_t m_byteCodePosition;
+        size_t m_frameStart;
+        size_t m_frameCount;
+    };
+
+    void recordSample(ExecutionState& state, ByteCodeBlock* byteCodeBlock, size_t byteCodePosition);
+
+    VMInstance* m_vmInstance;
+    Vector<Sample, GCUtil::gc_malloc_ignore_off_page_allocator<Sample>> m_samples;
+    Vector<CodeBlock*, GCUtil::gc_malloc_ignore_off_page_allocator<CodeBlock*>> m_frames;
+
+    static SamplingProfiler* s_runningProfiler;
+    static volatile bool s_sampleRequested;
+};
+}
+
+#endif
@@ -32,17 +32,14 @@ SetObject::SetObject(ExecutionState& state)
 
 void* SetObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(SetObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetObject, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetObject, m_values));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetObject, m_storage));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SetObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SetObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
@@ -141,17 +138,14 @@ SetIteratorObject::SetIteratorObject(ExecutionState& state, SetObject* set, Type
 
 void* SetIteratorObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(SetIteratorObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetIteratorObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetIteratorObject, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetIteratorObject, m_values));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetIteratorObject, m_set));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SetIteratorObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SetIteratorObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
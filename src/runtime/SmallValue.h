@@ -151,6 +151,10 @@ public:
         m_data.payload = (intptr_t)(ValueUndefined);
     }
 
+    // copy (and default copy assignment) takes payload as is, so a DoubleInSmallValue is shared by both.
+    // it is fine for moving values like vector growth, but a number store reuses box of its slot
+    // (see operator=(const Value&)), so copying into another live slot must go through Value
+    // like `slot = SmallValue(Value(other))`. otherwise storing into one slot changes the other
     SmallValue(const SmallValue& from)
     {
         m_data.payload = from.m_data.payload;
@@ -265,15 +269,12 @@ public:
             return;
         }
 
-        int32_t i32;
-        if (from.isInt32() && SmallValueImpl::PlatformSmiTagging::IsValidSmi(i32 = from.asInt32())) {
-            m_data.payload = SmallValueImpl::PlatformSmiTagging::IntToSmi(i32);
-            return;
-        }
-
         if (from.isNumber()) {
             auto payload = m_data.payload;
 
+            // once a slot owns a DoubleInSmallValue, every number stored in the slot goes into it
+            // (integers too) so a field like `p.x += vx` never allocates after its first double.
+            // reading a box converts to Value(double), which gives back int32 for integral values
             if (!HAS_SMI_TAG(payload) && ((size_t)payload > (size_t)ValueLast)) {
                 PointerValue* v = (PointerValue*)payload;
                 if (g_doubleInSmallValueTag == *((size_t*)v)) {
@@ -281,6 +282,13 @@ public:
                     return;
                 }
             }
+
+            int32_t i32;
+            if (from.isInt32() && SmallValueImpl::PlatformSmiTagging::IsValidSmi(i32 = from.asInt32())) {
+                m_data.payload = SmallValueImpl::PlatformSmiTagging::IntToSmi(i32);
+                return;
+            }
+
             m_data.payload = reinterpret_cast<intptr_t>(new DoubleInSmallValue(from.asNumber()));
             return;
         }
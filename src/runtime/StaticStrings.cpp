@@ -107,20 +107,19 @@ void StaticStrings::initStaticStrings(AtomicStringMap* atomicStringMap)
 
 ::Escargot::String* StaticStrings::dtoa(double d) const
 {
-    auto iter = dtoaCache.begin();
+    uint64_t bits = bitwise_cast<uint64_t>(d);
+    // mix high bits too, since integers and short decimals differ only in them
+    uint64_t hash = (bits ^ (bits >> 32)) * 0x9E3779B97F4A7C15ULL;
+    DtoaCacheEntry& entry = dtoaCache[hash >> 56];
+    static_assert(ESCARGOT_STRINGS_DTOA_CACHE_SIZE == 256, "index is top 8 bits of hash");
 
-    while (iter != dtoaCache.end()) {
-        if ((*iter).first == d) {
-            return (*iter).second;
-        }
-        iter++;
+    if (LIKELY(entry.m_string && entry.m_numberBits == bits)) {
+        return entry.m_string;
     }
 
     ::Escargot::String* s = String::fromDouble(d);
-    dtoaCache.push_front(std::make_pair(d, s));
-    if (dtoaCache.size() > dtoaCacheSize) {
-        dtoaCache.pop_back();
-    }
+    entry.m_numberBits = bits;
+    entry.m_string = s;
     return s;
 }
 }
@@ -385,8 +385,8 @@ namespace Escargot {
 class StaticStrings {
 public:
     StaticStrings()
-        : dtoaCacheSize(5)
     {
+        memset(dtoaCache, 0, sizeof(dtoaCache));
     }
     AtomicString NegativeInfinity;
     AtomicString stringTrue;
@@ -464,8 +464,13 @@ public:
 
     void initStaticStrings(AtomicStringMap* map);
 
-    const size_t dtoaCacheSize; // 5;
-    mutable std::list<std::pair<double, ::Escargot::String*>, GCUtil::gc_malloc_ignore_off_page_allocator<std::pair<double, ::Escargot::String*>>> dtoaCache;
+    // direct-mapped by bits of number. a new number just replaces the entry in its slot
+#define ESCARGOT_STRINGS_DTOA_CACHE_SIZE 256
+    struct DtoaCacheEntry {
+        uint64_t m_numberBits;
+        ::Escargot::String* m_string;
+    };
+    mutable DtoaCacheEntry dtoaCache[ESCARGOT_STRINGS_DTOA_CACHE_SIZE];
 
     ::Escargot::String* dtoa(double d) const;
 };
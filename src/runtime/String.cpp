@@ -49,6 +49,7 @@
 
 #include "fast-dtoa.h"
 #include "bignum-dtoa.h"
+#include "strtod.h"
 
 namespace Escargot {
 
@@ -435,11 +436,51 @@ void CreateExponentialRepresentation(
                                  kMaxExponentLength - first_char_pos);
 }
 
+char* integerToDecimal(int64_t value, char* bufferEnd)
+{
+    static const char digitPairs[201] = "00010203040506070809"
+                                        "10111213141516171819"
+                                        "20212223242526272829"
+                                        "30313233343536373839"
+                                        "40414243444546474849"
+                                        "50515253545556575859"
+                                        "60616263646566676869"
+                                        "70717273747576777879"
+                                        "80818283848586878889"
+                                        "90919293949596979899";
+
+    // negate in unsigned, so INT64_MIN does not overflow
+    uint64_t n = value < 0 ? 0 - (uint64_t)value : (uint64_t)value;
+    char* p = bufferEnd;
+    while (n >= 100) {
+        size_t idx = (n % 100) * 2;
+        n /= 100;
+        *--p = digitPairs[idx + 1];
+        *--p = digitPairs[idx];
+    }
+    if (n >= 10) {
+        *--p = digitPairs[n * 2 + 1];
+        *--p = digitPairs[n * 2];
+    } else {
+        *--p = '0' + n;
+    }
+    if (value < 0) {
+        *--p = '-';
+    }
+    return p;
+}
+
 ASCIIStringData dtoa(double number)
 {
     if (number == 0) {
         return ASCIIStringData("0", 1);
     }
+    if (isSafeIntegerDouble(number)) {
+        char buffer[ESCARGOT_INTEGER_TO_DECIMAL_BUFFER_LENGTH];
+        char* bufferEnd = buffer + ESCARGOT_INTEGER_TO_DECIMAL_BUFFER_LENGTH;
+        char* start = integerToDecimal((int64_t)number, bufferEnd);
+        return ASCIIStringData(start, bufferEnd - start);
+    }
     const int flags = UNIQUE_ZERO | EMIT_POSITIVE_EXPONENT_SIGN;
     bool sign = false;
     if (number < 0) {
@@ -473,7 +514,7 @@ ASCIIStringData dtoa(double number)
 
     const int bufferLength = 128;
     char buffer[bufferLength];
-    double_conversion::StringBuilder builder(buffer, bufferLength);
+    double_conversion::StringBuilder builder(buffer + 1, bufferLength - 1);
 
     int exponent = decimal_point - 1;
     const int decimal_in_shortest_low_ = -6;
@@ -488,15 +529,146 @@ ASCIIStringData dtoa(double number)
         CreateExponentialRepresentation(flags, decimal_rep, decimal_rep_length, exponent,
                                         &builder);
     }
-    ASCIIStringDataNonGCStd str;
-    if (sign)
-        str += '-';
+    // builder has room for the sign at the front
     char* buf = builder.Finalize();
-    while (*buf) {
-        str += *buf;
-        buf++;
+    if (sign) {
+        *--buf = '-';
     }
-    return ASCIIStringData(str.data(), str.length());
+    return ASCIIStringData(buf, strlen(buf));
+}
+
+// numbers up to 2^53 with decimal exponent in [-22, 22] are converted exactly by one
+// multiplication or division (Clinger's fast path). others go to Strtod with the digits collected
+static const double s_exactPowersOfTen[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+template <typename CharType>
+static bool isDecimalDigit(const CharType* p, const CharType* end)
+{
+    return p < end && *p >= '0' && *p <= '9';
+}
+
+template <typename CharType>
+static const CharType* parseDecimalLiteralImpl(const CharType* start, const CharType* end, double& result)
+{
+    // Strtod doesn't look digits more than this
+    const int maxSignificantDigits = 780;
+    const int maxExponent = 100000;
+
+    const CharType* p = start;
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        p++;
+    }
+
+    static const char infinity[] = "Infinity";
+    if (p < end && *p == 'I') {
+        for (size_t i = 0; i < 8; i++) {
+            if (p + i >= end || p[i] != infinity[i]) {
+                return start;
+            }
+        }
+        result = negative ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+        return p + 8;
+    }
+
+    char digits[maxSignificantDigits];
+    int digitCount = 0;
+    uint64_t mantissa = 0;
+    int exponent = 0;
+    bool sawDigit = false;
+    bool droppedNonZero = false;
+
+    while (isDecimalDigit(p, end)) {
+        sawDigit = true;
+        if (digitCount < maxSignificantDigits - 1) {
+            if (digitCount || *p != '0') {
+                digits[digitCount++] = *p;
+                mantissa = mantissa * 10 + (*p - '0');
+            }
+        } else {
+            droppedNonZero |= *p != '0';
+            exponent++;
+        }
+        p++;
+    }
+
+    if (p < end && *p == '.') {
+        const CharType* fractionStart = ++p;
+        while (isDecimalDigit(p, end)) {
+            if (digitCount < maxSignificantDigits - 1) {
+                if (digitCount || *p != '0') {
+                    digits[digitCount++] = *p;
+                    mantissa = mantissa * 10 + (*p - '0');
+                }
+                exponent--;
+            } else {
+                droppedNonZero |= *p != '0';
+            }
+            p++;
+        }
+        sawDigit |= p != fractionStart;
+    }
+
+    if (!sawDigit) {
+        return start;
+    }
+
+    // exponent part is taken only when it has digits
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const CharType* e = p + 1;
+        bool negativeExponent = false;
+        if (e < end && (*e == '+' || *e == '-')) {
+            negativeExponent = *e == '-';
+            e++;
+        }
+        if (isDecimalDigit(e, end)) {
+            int value = 0;
+            while (isDecimalDigit(e, end)) {
+                if (value < maxExponent) {
+                    value = value * 10 + (*e - '0');
+                }
+                e++;
+            }
+            exponent += negativeExponent ? -value : value;
+            p = e;
+        }
+    }
+
+    double value;
+    if (digitCount == 0) {
+        value = 0;
+    } else if (digitCount <= 19 && mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22) {
+        value = (double)mantissa;
+        if (exponent < 0) {
+            value /= s_exactPowersOfTen[-exponent];
+        } else {
+            value *= s_exactPowersOfTen[exponent];
+        }
+    } else {
+        if (droppedNonZero) {
+            // a trailing non-zero digit keeps rounding of the cut digits right
+            digits[digitCount++] = '1';
+            exponent--;
+        }
+        value = double_conversion::Strtod(double_conversion::Vector<const char>(digits, digitCount), exponent);
+    }
+
+    result = negative ? -value : value;
+    return p;
+}
+
+const LChar* parseDecimalLiteral(const LChar* start, const LChar* end, double& result)
+{
+    return parseDecimalLiteralImpl(start, end, result);
+}
+
+const char16_t* parseDecimalLiteral(const char16_t* start, const char16_t* end, double& result)
+{
+    return parseDecimalLiteralImpl(start, end, result);
 }
 
 String* String::fromASCII(const char* src)
@@ -506,10 +678,26 @@ String* String::fromASCII(const char* src)
 
 String* String::fromDouble(double v)
 {
+    if (isSafeIntegerDouble(v)) {
+        return fromInt64((int64_t)v);
+    }
     auto s = dtoa(v);
     return new ASCIIString(std::move(s));
 }
 
+String* String::fromInt32(int32_t v)
+{
+    return fromInt64(v);
+}
+
+String* String::fromInt64(int64_t v)
+{
+    char buffer[ESCARGOT_INTEGER_TO_DECIMAL_BUFFER_LENGTH];
+    char* bufferEnd = buffer + ESCARGOT_INTEGER_TO_DECIMAL_BUFFER_LENGTH;
+    char* start = integerToDecimal(v, bufferEnd);
+    return new ASCIIString(start, bufferEnd - start);
+}
+
 String* String::fromUTF8(const char* src, size_t len)
 {
     if (isAllASCII(src, len)) {
@@ -520,18 +708,44 @@ String* String::fromUTF8(const char* src, size_t len)
     }
 }
 
-int String::stringCompare(size_t l1, size_t l2, const String* c1, const String* c2)
+static int compareBuffers(const StringBufferAccessData& a, size_t aStart, const StringBufferAccessData& b, size_t bStart, size_t length)
 {
-    size_t s = 0;
-    const unsigned lmin = l1 < l2 ? l1 : l2;
-    unsigned pos = 0;
-    while (pos < lmin && c1->charAt(s) == c2->charAt(s)) {
-        ++s;
-        ++pos;
+    if (a.has8BitContent && b.has8BitContent) {
+        int result = memcmp((const LChar*)a.buffer + aStart, (const LChar*)b.buffer + bStart, length);
+        return result > 0 ? 1 : (result < 0 ? -1 : 0);
     }
+    for (size_t i = 0; i < length; i++) {
+        char16_t ca = a.charAt(aStart + i);
+        char16_t cb = b.charAt(bStart + i);
+        if (ca != cb) {
+            return ca > cb ? 1 : -1;
+        }
+    }
+    return 0;
+}
 
-    if (pos < lmin)
-        return (c1->charAt(s) > c2->charAt(s)) ? 1 : -1;
+int String::compareRange(const String* a, size_t aStart, const String* b, size_t bStart, size_t length)
+{
+    int result = 0;
+    size_t bPos = bStart;
+    RopeString::forEachPiece(const_cast<String*>(a), aStart, aStart + length, [&](const StringBufferAccessData& aData, size_t aFrom, size_t aTo) -> bool {
+        size_t aIdx = aFrom;
+        bool continues = RopeString::forEachPiece(const_cast<String*>(b), bPos, bPos + (aTo - aFrom), [&](const StringBufferAccessData& bData, size_t bFrom, size_t bTo) -> bool {
+            result = compareBuffers(aData, aIdx, bData, bFrom, bTo - bFrom);
+            aIdx += bTo - bFrom;
+            return !result;
+        });
+        bPos += aTo - aFrom;
+        return continues;
+    });
+    return result;
+}
+
+int String::stringCompare(size_t l1, size_t l2, const String* c1, const String* c2)
+{
+    int result = compareRange(c1, 0, c2, 0, std::min(l1, l2));
+    if (result)
+        return result;
 
     if (l1 == l2)
         return 0;
@@ -541,6 +755,11 @@ int String::stringCompare(size_t l1, size_t l2, const String* c1, const String*
 
 bool String::equals(const String* src) const
 {
+    if (UNLIKELY(m_bufferAccessData.hasSpecialImpl || src->m_bufferAccessData.hasSpecialImpl)) {
+        size_t len = length();
+        return len == src->length() && !compareRange(this, 0, src, 0, len);
+    }
+
     const auto& myData = bufferAccessData();
     const auto& srcData = src->bufferAccessData();
     if (srcData.length != myData.length) {
@@ -641,6 +860,44 @@ uint64_t String::tryToUseAsIndex() const
     return number;
 }
 
+template <typename CharType, typename PatternCharType>
+static size_t findInBuffer(const CharType* src, size_t size, const PatternCharType* pattern, size_t patternLength, size_t pos)
+{
+    const PatternCharType first = pattern[0];
+    for (; pos <= size - patternLength; ++pos) {
+        if (src[pos] == first) {
+            bool same = true;
+            for (size_t k = 1; k < patternLength; k++) {
+                if (src[pos + k] != pattern[k]) {
+                    same = false;
+                    break;
+                }
+            }
+            if (same)
+                return pos;
+        }
+    }
+    return SIZE_MAX;
+}
+
+// memchr skips to candidates of first character much faster than comparing one by one
+static size_t findInBuffer(const LChar* src, size_t size, const LChar* pattern, size_t patternLength, size_t pos)
+{
+    const LChar* end = src + size - patternLength + 1;
+    const LChar* p = src + pos;
+    while (p < end) {
+        p = (const LChar*)memchr(p, pattern[0], end - p);
+        if (!p) {
+            break;
+        }
+        if (!memcmp(p + 1, pattern + 1, patternLength - 1)) {
+            return p - src;
+        }
+        p++;
+    }
+    return SIZE_MAX;
+}
+
 size_t String::find(String* str, size_t pos)
 {
     const size_t srcStrLen = str->length();
@@ -649,40 +906,21 @@ size_t String::find(String* str, size_t pos)
     if (srcStrLen == 0)
         return pos <= size ? pos : SIZE_MAX;
 
-    if (srcStrLen <= size) {
-        char32_t src0 = str->charAt(0);
-        const auto& data = bufferAccessData();
-        if (data.has8BitContent) {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const LChar*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const LChar*)data.buffer)[pos + k] != str->charAt(k)) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
-        } else {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const char16_t*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const char16_t*)data.buffer)[pos + k] != str->charAt(k)) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
+    if (srcStrLen > size || pos > size - srcStrLen)
+        return SIZE_MAX;
+
+    const auto& data = bufferAccessData();
+    const auto& patternData = str->bufferAccessData();
+    if (data.has8BitContent) {
+        if (patternData.has8BitContent) {
+            return findInBuffer((const LChar*)data.buffer, size, (const LChar*)patternData.buffer, srcStrLen, pos);
         }
+        return findInBuffer((const LChar*)data.buffer, size, (const char16_t*)patternData.buffer, srcStrLen, pos);
     }
-    return SIZE_MAX;
+    if (patternData.has8BitContent) {
+        return findInBuffer((const char16_t*)data.buffer, size, (const LChar*)patternData.buffer, srcStrLen, pos);
+    }
+    return findInBuffer((const char16_t*)data.buffer, size, (const char16_t*)patternData.buffer, srcStrLen, pos);
 }
 
 size_t String::rfind(String* str, size_t pos)
@@ -712,10 +950,26 @@ size_t String::rfind(String* str, size_t pos)
 
 String* String::substring(size_t from, size_t to)
 {
-    if (to - from > STRING_SUB_STRING_MIN_VIEW_LENGTH) {
-        StringView* str = new StringView(this, from, to);
+    // substring of view is a view of the root string, so it is measured against the root
+    String* root = this;
+    size_t rootFrom = from;
+    if (isStringView()) {
+        StringView* view = (StringView*)this;
+        root = view->string();
+        rootFrom += view->start();
+    }
+
+    if (to - from > STRING_SUB_STRING_MIN_VIEW_LENGTH && !StringView::shouldCopyInsteadOfView(root->length(), to - from)) {
+        StringView* str = new StringView(root, rootFrom, rootFrom + (to - from));
         return str;
     }
+    if (from == to) {
+        return String::emptyString;
+    }
+    const auto& data = bufferAccessData();
+    if (data.has8BitContent) {
+        return new Latin1String((const LChar*)data.buffer + from, to - from);
+    }
     StringBuilder builder;
     builder.appendSubString(this, from, to);
     return builder.finalize();
@@ -724,40 +978,34 @@ String* String::substring(size_t from, size_t to)
 
 void* ASCIIString::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(ASCIIString)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ASCIIString, m_bufferAccessData.buffer));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ASCIIString));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ASCIIString));
+    }();
+    Heap::objectAllocationCounts().m_stringCount.increase();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
 void* Latin1String::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(Latin1String)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(Latin1String, m_bufferAccessData.buffer));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(Latin1String));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(Latin1String));
+    }();
+    Heap::objectAllocationCounts().m_stringCount.increase();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
 void* UTF16String::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(UTF16String)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(UTF16String, m_bufferAccessData.buffer));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(UTF16String));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(UTF16String));
+    }();
+    Heap::objectAllocationCounts().m_stringCount.increase();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
@@ -50,6 +50,19 @@ UTF16StringData utf8StringToUTF16String(const char* buf, const size_t& len);
 UTF8StringData utf16StringToUTF8String(const char16_t* buf, const size_t& len);
 ASCIIStringData utf16StringToASCIIString(const char16_t* buf, const size_t& len);
 ASCIIStringData dtoa(double number);
+// parses StrDecimalLiteral (sign, Infinity, digits, fraction and exponent) from start.
+// returns the end of the literal, or start if there is none. whitespace and hex are not handled here
+const LChar* parseDecimalLiteral(const LChar* start, const LChar* end, double& result);
+const char16_t* parseDecimalLiteral(const char16_t* start, const char16_t* end, double& result);
+// writes decimal digits of value backward from bufferEnd and returns the first character.
+// buffer needs ESCARGOT_INTEGER_TO_DECIMAL_BUFFER_LENGTH characters
+#define ESCARGOT_INTEGER_TO_DECIMAL_BUFFER_LENGTH 20
+char* integerToDecimal(int64_t value, char* bufferEnd);
+// true if every integer up to the value can be represented in double
+inline bool isSafeIntegerDouble(double number)
+{
+    return std::abs(number) <= 9007199254740991.0 && number == std::trunc(number);
+}
 size_t utf32ToUtf8(char32_t uc, char* UTF8);
 // these functions only care ascii range(0~127)
 bool islower(char16_t ch);
@@ -175,6 +188,11 @@ public:
         return false;
     }
 
+    virtual bool isStringView()
+    {
+        return false;
+    }
+
     bool has8BitContent() const
     {
         return bufferAccessData().has8BitContent;
@@ -183,11 +201,8 @@ public:
     static String* fromASCII(const char* s);
     static String* fromCharCode(char32_t code);
     static String* fromDouble(double v);
-    static String* fromInt32(int32_t v)
-    {
-        // TODO
-        return fromDouble(v);
-    }
+    static String* fromInt32(int32_t v);
+    static String* fromInt64(int64_t v);
     static String* fromUTF8(const char* src, size_t len);
 
     virtual size_t length() const = 0;
@@ -226,22 +241,45 @@ public:
         return true;
     }
 
+    // compares a[aStart, aStart + length) with b[bStart, bStart + length), without flattening ropes.
+    // returns negative, zero or positive like strcmp
+    static int compareRange(const String* a, size_t aStart, const String* b, size_t bStart, size_t length);
+
     size_t find(String* str, size_t pos = 0);
     size_t rfind(String* str, size_t pos);
 
     String* substring(size_t from, size_t to);
 
+    static const size_t stringHashSeed = static_cast<size_t>(0xc70f6907UL);
+
+    // hash can be computed piece by piece by passing previous result as seed
     template <typename T>
-    static inline size_t stringHash(T* src, size_t length)
+    static inline size_t stringHash(T* src, size_t length, size_t hash = stringHashSeed)
     {
-        size_t hash = static_cast<size_t>(0xc70f6907UL);
         for (; length; --length)
             hash = (hash * 131) + *src++;
         return hash;
     }
 
+    static size_t adjustHashValue(size_t hash)
+    {
+        if (UNLIKELY((hash % sizeof(size_t)) == 0)) {
+            hash++;
+        }
+        return hash;
+    }
+
+    virtual size_t hashValueSpecialImpl() const
+    {
+        RELEASE_ASSERT_NOT_REACHED();
+        return 0;
+    }
+
     size_t hashValue() const
     {
+        if (UNLIKELY(m_bufferAccessData.hasSpecialImpl)) {
+            return hashValueSpecialImpl();
+        }
         const auto& data = bufferAccessData();
         size_t len = data.length;
         size_t hash;
@@ -253,11 +291,7 @@ public:
             hash = stringHash(ptr, len);
         }
 
-        if (UNLIKELY((hash % sizeof(size_t)) == 0)) {
-            hash++;
-        }
-
-        return hash;
+        return adjustHashValue(hash);
     }
 
     bool operator==(const String& src) const
@@ -34,17 +34,14 @@ StringObject::StringObject(ExecutionState& state, String* value)
 
 void* StringObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(StringObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(StringObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(StringObject, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(StringObject, m_values));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(StringObject, m_primitiveValue));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(StringObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(StringObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
@@ -110,17 +107,14 @@ StringIteratorObject::StringIteratorObject(ExecutionState& state, String* s)
 
 void* StringIteratorObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(StringIteratorObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(StringIteratorObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(StringIteratorObject, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(StringIteratorObject, m_values));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(StringIteratorObject, m_string));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(StringIteratorObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(StringIteratorObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
@@ -24,26 +24,22 @@ namespace Escargot {
 
 void* StringView::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(StringView)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(StringView, m_string));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(StringView));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(StringView));
+    }();
+    Heap::objectAllocationCounts().m_stringCount.increase();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
 void* SourceStringView::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(SourceStringView)] = { 0 };
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SourceStringView));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SourceStringView));
+    }();
+    Heap::objectAllocationCounts().m_stringCount.increase();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 }
@@ -26,9 +26,10 @@ namespace Escargot {
 
 class StringView : public String {
 public:
+    // view of view refers its root string directly, so m_string is never a StringView
     ALWAYS_INLINE StringView(String* str, const size_t& s, const size_t& e)
         : String()
-        , m_string(str)
+        , m_string(str->isStringView() ? ((StringView*)str)->string() : str)
     {
         ASSERT(s <= e);
         ASSERT(e <= str->length());
@@ -49,6 +50,11 @@ public:
         initBufferAccessData(String::emptyString->bufferAccessData(), 0, 0);
     }
 
+    virtual bool isStringView()
+    {
+        return true;
+    }
+
     virtual char16_t charAt(const size_t& idx) const
     {
         return bufferAccessData().charAt(idx);
@@ -136,6 +142,13 @@ public:
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
 
+    // view keeps whole of its root string alive, so stringLength should be length of the root.
+    // returns true if copying is better than a view which pins a large string for small part of it
+    static bool shouldCopyInsteadOfView(size_t stringLength, size_t viewLength)
+    {
+        return stringLength >= STRING_VIEW_LARGE_PARENT_LENGTH && viewLength < stringLength / STRING_VIEW_MIN_PARENT_FRACTION;
+    }
+
     String* string() const
     {
         return m_string;
@@ -33,17 +33,14 @@ SymbolObject::SymbolObject(ExecutionState& state, Symbol* value)
 
 void* SymbolObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(SymbolObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SymbolObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SymbolObject, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SymbolObject, m_values));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SymbolObject, m_primitiveValue));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SymbolObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SymbolObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 }
@@ -138,17 +138,14 @@ public:
 
     void* operator new(size_t size)
     {
-        static bool typeInited = false;
-        static GC_descr descr;
-        if (!typeInited) {
+        static GC_descr descr = [] {
             GC_word obj_bitmap[GC_BITMAP_SIZE(ArrayBufferView)] = { 0 };
             GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayBufferView, m_structure));
             GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayBufferView, m_prototype));
             GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayBufferView, m_values));
             GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ArrayBufferView, m_buffer));
-            descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ArrayBufferView));
-            typeInited = true;
-        }
+            return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ArrayBufferView));
+        }();
         return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
     }
     void* operator new[](size_t size) = delete;
@@ -285,6 +282,11 @@ public:
         Object::enumeration(state, callback, data);
     }
 
+    virtual bool canUseEnumerationCache() override
+    {
+        return false;
+    }
+
     void allocateTypedArray(ExecutionState& state, unsigned length)
     {
         auto obj = new ArrayBufferObject(state);
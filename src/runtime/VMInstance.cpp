@@ -23,6 +23,9 @@
 #include "ArrayObject.h"
 #include "StringObject.h"
 #include "JobQueue.h"
+#include "SandBox.h"
+#include "SamplingProfiler.h"
+#include "util/Util.h"
 
 namespace Escargot {
 
@@ -153,10 +156,16 @@ VMInstance::VMInstance(const char* locale, const char* timezone)
     : m_didSomePrototypeObjectDefineIndexedProperty(false)
     , m_compiledByteCodeSize(0)
     , m_cachedUTC(nullptr)
+    , m_samplingProfiler(nullptr)
 {
-    if (!String::emptyString) {
+    // process-wide values are same for every VMInstance, but VMInstances can be created on several threads at once
+    static std::once_flag globalValuesInitFlag;
+    std::call_once(globalValuesInitFlag, []() {
         String::emptyString = new (NoGC) ASCIIString("");
-    }
+        g_doubleInSmallValueTag = DoubleInSmallValue(0).getTag();
+        g_objectRareDataTag = ObjectRareData(nullptr).getTag();
+        g_symbolTag = Symbol(nullptr).getTag();
+    });
     m_staticStrings.initStaticStrings(&m_atomicStringMap);
 
     // TODO call destructor
@@ -181,12 +190,6 @@ VMInstance::VMInstance(const char* locale, const char* timezone)
     }
 #endif
 
-    g_doubleInSmallValueTag = DoubleInSmallValue(0).getTag();
-
-    g_objectRareDataTag = ObjectRareData(nullptr).getTag();
-
-    g_symbolTag = Symbol(nullptr).getTag();
-
 #define DECLARE_GLOBAL_SYMBOLS(name) m_globalSymbols.name = new Symbol(String::fromASCII("Symbol." #name));
     DEFINE_GLOBAL_SYMBOLS(DECLARE_GLOBAL_SYMBOLS);
 #undef DECLARE_GLOBAL_SYMBOLS
@@ -280,6 +283,9 @@ VMInstance::VMInstance(const char* locale, const char* timezone)
     m_jobQueue = JobQueue::create();
     m_jobQueueListener = nullptr;
     m_publicJobQueueListenerPointer = nullptr;
+    m_pendingJobListener = nullptr;
+    m_pendingJobListenerData = nullptr;
+    m_publicPendingJobListenerPointer = nullptr;
 #endif
 }
 
@@ -289,6 +295,36 @@ void VMInstance::clearCaches()
     m_regexpCache.clear();
     m_cachedUTC = nullptr;
     globalSymbolRegistry().clear();
+#ifdef ENABLE_ICU
+    m_icuObjectCache.clear();
+#endif
+}
+
+bool VMInstance::startSamplingProfiler(size_t intervalInMicroseconds)
+{
+    if (!m_samplingProfiler) {
+        m_samplingProfiler = new SamplingProfiler(this);
+    }
+    return m_samplingProfiler->start(intervalInMicroseconds);
+}
+
+std::string VMInstance::stopSamplingProfiler()
+{
+    if (!m_samplingProfiler || !m_samplingProfiler->isRunning()) {
+        return std::string();
+    }
+    m_samplingProfiler->stop();
+    std::string result = m_samplingProfiler->collapsedStacks();
+    m_samplingProfiler = nullptr;
+    return result;
+}
+
+void VMInstance::discardSamplingProfiler()
+{
+    if (m_samplingProfiler) {
+        m_samplingProfiler->stop();
+        m_samplingProfiler = nullptr;
+    }
 }
 
 void VMInstance::somePrototypeObjectDefineIndexedProperty(ExecutionState& state)
@@ -336,21 +372,50 @@ bool VMInstance::removeRoot(void* ptr)
     return true;
 }
 
-Value VMInstance::drainJobQueue()
+Value VMInstance::drainJobQueue(size_t maxJobCount, uint64_t maxTimeInMicroseconds)
 {
     ASSERT(!m_jobQueueListener);
 
     DefaultJobQueue* jobQueue = DefaultJobQueue::get(this->jobQueue());
-    while (jobQueue->hasNextJob()) {
-        auto jobResult = jobQueue->nextJob()->run();
-        if (!jobResult.error.isEmpty())
-            return jobResult.error;
+    uint64_t deadline = maxTimeInMicroseconds ? longTickCount() + maxTimeInMicroseconds : 0;
+    size_t count = 0;
+    bool timeOver = false;
+    while (jobQueue->hasNextJob() && count < maxJobCount && !timeOver) {
+        Context* context = jobQueue->peekJob()->relatedContext();
+        SandBox sandbox(context);
+        auto result = sandbox.run([&]() -> Value {
+            ExecutionState state(context);
+            while (jobQueue->hasNextJob() && count < maxJobCount && jobQueue->peekJob()->relatedContext() == context) {
+                Job* job = jobQueue->nextJob();
+                count++;
+                job->execute(state);
+                jobQueue->recycleJob(job);
+                if (deadline && longTickCount() >= deadline) {
+                    timeOver = true;
+                    break;
+                }
+            }
+            return Value();
+        });
+        if (!result.error.isEmpty())
+            return result.error;
     }
     return Value(Value::EmptyValue);
 }
 
+size_t VMInstance::pendingJobCount()
+{
+    return DefaultJobQueue::get(this->jobQueue())->pendingJobCount();
+}
+
 void VMInstance::setNewPromiseJobListener(NewPromiseJobListener l)
 {
     m_jobQueueListener = l;
 }
+
+void VMInstance::setPendingJobListener(PendingJobListener l, void* data)
+{
+    m_pendingJobListener = l;
+    m_pendingJobListenerData = data;
+}
 }
@@ -23,6 +23,7 @@
 #include "runtime/Context.h"
 #include "runtime/AtomicString.h"
 #include "runtime/GlobalObject.h"
+#include "runtime/ICUObjectCache.h"
 #include "runtime/RegExpObject.h"
 #include "runtime/StaticStrings.h"
 #include "runtime/String.h"
@@ -35,6 +36,7 @@ class SandBox;
 class CodeBlock;
 class JobQueue;
 class Job;
+class SamplingProfiler;
 
 // TODO species, match, replace, search, split, isConcatSpreadable
 #define DEFINE_GLOBAL_SYMBOLS(F) \
@@ -67,6 +69,7 @@ public:
     VMInstance(const char* locale = nullptr, const char* timezone = nullptr);
     ~VMInstance()
     {
+        discardSamplingProfiler();
         clearCaches();
 #ifdef ENABLE_ICU
         delete m_timezone;
@@ -117,6 +120,11 @@ public:
     {
         m_timezoneID = id;
     }
+
+    ICUObjectCache& icuObjectCache()
+    {
+        return m_icuObjectCache;
+    }
 #endif
     DateObject* cachedUTC() const
     {
@@ -175,12 +183,25 @@ public:
 
     // if there is an error, executing will be stopped and returns ErrorValue
     // if thres is no job or no error, returns EmptyValue
-    Value drainJobQueue();
+    // it stops after running maxJobCount jobs or after maxTimeInMicroseconds (0 means no limit)
+    // jobs of same context are ran in one SandBox
+    Value drainJobQueue(size_t maxJobCount = SIZE_MAX, uint64_t maxTimeInMicroseconds = 0);
+    size_t pendingJobCount();
 
     typedef void (*NewPromiseJobListener)(ExecutionState& state, Job* job);
     void setNewPromiseJobListener(NewPromiseJobListener l);
+
+    // called when a job is added into empty job queue, so embedder can schedule drainJobQueue
+    typedef void (*PendingJobListener)(VMInstance* instance, void* data);
+    void setPendingJobListener(PendingJobListener l, void* data);
 #endif
 
+    // only one VMInstance of the process can be profiled at a time.
+    // returns false if the profiler cannot be started
+    bool startSamplingProfiler(size_t intervalInMicroseconds);
+    // returns samples taken so far in collapsed stack format of flamegraph.pl
+    std::string stopSamplingProfiler();
+
     void addRoot(void* ptr);
     bool removeRoot(void* ptr);
 
@@ -200,6 +221,8 @@ public:
     }
 
 private:
+    void discardSamplingProfiler();
+
     StaticStrings m_staticStrings;
     AtomicStringMap m_atomicStringMap;
     GlobalSymbols m_globalSymbols;
@@ -243,14 +266,20 @@ private:
     icu::Locale m_locale;
     icu::TimeZone* m_timezone;
     icu::UnicodeString m_timezoneID;
+    ICUObjectCache m_icuObjectCache;
 #endif
     DateObject* m_cachedUTC;
 
+    SamplingProfiler* m_samplingProfiler;
+
 // promise data
 #if ESCARGOT_ENABLE_PROMISE
     JobQueue* m_jobQueue;
     NewPromiseJobListener m_jobQueueListener;
     void* m_publicJobQueueListenerPointer;
+    PendingJobListener m_pendingJobListener;
+    void* m_pendingJobListenerData;
+    void* m_publicPendingJobListenerPointer;
 #endif
 };
 } // namespace Escargot
@@ -32,6 +32,7 @@
 #include "SymbolObject.h"
 #include "BooleanObject.h"
 #include "ErrorObject.h"
+#include "parser/Lexer.h"
 
 // dtoa
 #include "ieee.h"
@@ -407,13 +408,102 @@ bool Value::equalsToByTheSameValueZeroAlgorithm(ExecutionState& ec, const Value&
     return false;
 }
 
+static int radixOfNonDecimalPrefix(char16_t c)
+{
+    switch (c) {
+    case 'x':
+    case 'X':
+        return 16;
+    case 'o':
+    case 'O':
+        return 8;
+    case 'b':
+    case 'B':
+        return 2;
+    default:
+        return 0;
+    }
+}
+
+// $7.1.3.1 ToNumber Applied to the String Type
+template <typename CharType>
+static double stringToNumber(const CharType* start, size_t length)
+{
+    const CharType* end = start + length;
+    while (start < end && EscargotLexer::isWhiteSpaceOrLineTerminator(*start)) {
+        start++;
+    }
+    while (start < end && EscargotLexer::isWhiteSpaceOrLineTerminator(*(end - 1))) {
+        end--;
+    }
+
+    // A StringNumericLiteral that is empty or contains only white space is converted to +0.
+    if (start == end) {
+        return 0;
+    }
+
+    // hex, octal and binary literals don't allow sign
+    if (end - start > 2 && start[0] == '0' && radixOfNonDecimalPrefix(start[1])) {
+        int radix = radixOfNonDecimalPrefix(start[1]);
+        int bitsPerDigit = radix == 16 ? 4 : (radix == 8 ? 3 : 1);
+        const CharType* p = start + 2;
+        // every radix here is power of 2, so digits are kept as exact bits.
+        // once the integer is full, later digits only decide rounding (sticky)
+        uint64_t integer = 0;
+        size_t droppedBits = 0;
+        bool sticky = false;
+        for (; p < end; p++) {
+            int digit;
+            if (*p >= '0' && *p <= '9') {
+                digit = *p - '0';
+            } else if ((*p | 0x20) >= 'a' && (*p | 0x20) <= 'f') {
+                digit = (*p | 0x20) - 'a' + 10;
+            } else {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            if (digit >= radix) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            if (integer < (1ULL << 60)) {
+                integer = (integer << bitsPerDigit) | digit;
+            } else {
+                droppedBits += bitsPerDigit;
+                sticky |= digit != 0;
+            }
+        }
+
+        if (integer < (1ULL << 53)) {
+            return integer;
+        }
+
+        // round to 53 significant bits, ties to even
+        int shift = 0;
+        while ((integer >> shift) >= (1ULL << 53)) {
+            shift++;
+        }
+        uint64_t mantissa = integer >> shift;
+        uint64_t rest = integer & ((1ULL << shift) - 1);
+        uint64_t half = 1ULL << (shift - 1);
+        if (rest > half || (rest == half && (sticky || (mantissa & 1)))) {
+            mantissa++;
+        }
+        // exponent over 1024 is already infinity
+        return std::ldexp((double)mantissa, (int)std::min(droppedBits + shift, (size_t)2048));
+    }
+
+    double result;
+    if (parseDecimalLiteral(start, end, result) != end) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return result;
+}
+
 double Value::toNumberSlowCase(ExecutionState& state) const // $7.1.3 ToNumber
 {
     ASSERT(isPointerValue());
     PointerValue* o = asPointerValue();
     bool isString = o->isString();
     if (isString || o->isStringObject()) {
-        double val;
         String* data;
         if (LIKELY(isString)) {
             data = o->asString();
@@ -423,128 +513,10 @@ double Value::toNumberSlowCase(ExecutionState& state) const // $7.1.3 ToNumber
         }
 
         const auto& bufferAccessData = data->bufferAccessData();
-
-        const size_t len = bufferAccessData.length;
-
-        // A StringNumericLiteral that is empty or contains only white space is converted to +0.
-        if (len == 0)
-            return 0;
-
-        int end;
-        char* buf;
-
-        buf = ALLOCA(len + 1, char, state);
         if (LIKELY(bufferAccessData.has8BitContent)) {
-            const LChar* src = (const LChar*)bufferAccessData.buffer;
-            for (unsigned i = 0; i < len; i++) {
-                LChar c = src[i];
-                if (UNLIKELY(c >= 128))
-                    c = 0;
-                buf[i] = c;
-            }
-        } else {
-            const char16_t* src = (const char16_t*)bufferAccessData.buffer;
-            for (unsigned i = 0; i < len; i++) {
-                char16_t c = src[i];
-                if (c >= 128)
-                    c = 0;
-                buf[i] = c;
-            }
-        }
-
-        buf[len] = 0;
-        if (UNLIKELY(len >= 3 && (!strncmp("-0x", buf, 3) || !strncmp("+0x", buf, 3)))) { // hex number with Unary Plus or Minus is invalid in JavaScript while it is valid in C
-            val = std::numeric_limits<double>::quiet_NaN();
-            return val;
-        }
-        double_conversion::StringToDoubleConverter converter(double_conversion::StringToDoubleConverter::ALLOW_HEX
-                                                                 | double_conversion::StringToDoubleConverter::ALLOW_LEADING_SPACES
-                                                                 | double_conversion::StringToDoubleConverter::ALLOW_TRAILING_SPACES,
-                                                             0.0, double_conversion::Double::NaN(),
-                                                             "Infinity", "NaN");
-        val = converter.StringToDouble(buf, len, &end);
-        if (static_cast<size_t>(end) != len) {
-            auto isSpace = [](char16_t c) -> bool {
-                switch (c) {
-                case 0x0009:
-                case 0x000A:
-                case 0x000B:
-                case 0x000C:
-                case 0x000D:
-                case 0x0020:
-                case 0x00A0:
-                case 0x1680:
-                case 0x180E:
-                case 0x2000:
-                case 0x2001:
-                case 0x2002:
-                case 0x2003:
-                case 0x2004:
-                case 0x2005:
-                case 0x2006:
-                case 0x2007:
-                case 0x2008:
-                case 0x2009:
-                case 0x200A:
-                case 0x2028:
-                case 0x2029:
-                case 0x202F:
-                case 0x205F:
-                case 0x3000:
-                case 0xFEFF:
-                    return true;
-                default:
-                    return false;
-                }
-            };
-
-            unsigned ptr = 0;
-            enum State { Initial,
-                         ReadingNumber,
-                         DoneReadingNumber,
-                         Invalid };
-            State state = State::Initial;
-            for (unsigned i = 0; i < len; i++) {
-                char16_t ch;
-                if (LIKELY(bufferAccessData.has8BitContent)) {
-                    ch = ((LChar*)bufferAccessData.buffer)[i];
-                } else {
-                    ch = ((char16_t*)bufferAccessData.buffer)[i];
-                }
-                switch (state) {
-                case Initial:
-                    if (isSpace(ch))
-                        break;
-                    else
-                        state = State::ReadingNumber;
-                // Fall through.
-                case ReadingNumber:
-                    if (isSpace(ch))
-                        state = State::DoneReadingNumber;
-                    else {
-                        char16_t c = ch;
-                        if (c >= 128)
-                            c = 0;
-                        buf[ptr++] = c;
-                    }
-                    break;
-                case DoneReadingNumber:
-                    if (!isSpace(ch))
-                        state = State::Invalid;
-                    break;
-                case Invalid:
-                    break;
-                }
-            }
-            if (state != State::Invalid) {
-                buf[ptr] = 0;
-                val = converter.StringToDouble(buf, ptr, &end);
-                if (static_cast<size_t>(end) != ptr)
-                    val = std::numeric_limits<double>::quiet_NaN();
-            } else
-                val = std::numeric_limits<double>::quiet_NaN();
+            return stringToNumber((const LChar*)bufferAccessData.buffer, bufferAccessData.length);
         }
-        return val;
+        return stringToNumber((const char16_t*)bufferAccessData.buffer, bufferAccessData.length);
     } else if (isSymbol()) {
         ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "Cannot convert a Symbol value to a number");
         ASSERT_NOT_REACHED();
@@ -32,30 +32,24 @@ WeakMapObject::WeakMapObject(ExecutionState& state)
 
 void* WeakMapObject::WeakMapObjectDataItem::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(WeakMapObject::WeakMapObjectDataItem)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(WeakMapObject::WeakMapObjectDataItem, data));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(WeakMapObject::WeakMapObjectDataItem));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(WeakMapObject::WeakMapObjectDataItem));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
 void* WeakMapObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(WeakMapObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(WeakMapObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(WeakMapObject, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(WeakMapObject, m_values));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(WeakMapObject, m_storage));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(WeakMapObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(WeakMapObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
@@ -32,17 +32,14 @@ WeakSetObject::WeakSetObject(ExecutionState& state)
 
 void* WeakSetObject::operator new(size_t size)
 {
-    static bool typeInited = false;
-    static GC_descr descr;
-    if (!typeInited) {
+    static GC_descr descr = [] {
         GC_word obj_bitmap[GC_BITMAP_SIZE(WeakSetObject)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(WeakSetObject, m_structure));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(WeakSetObject, m_prototype));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(WeakSetObject, m_values));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(WeakSetObject, m_storage));
-        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(WeakSetObject));
-        typeInited = true;
-    }
+        return GC_make_descriptor(obj_bitmap, GC_WORD_LEN(WeakSetObject));
+    }();
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
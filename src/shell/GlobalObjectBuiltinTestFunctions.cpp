@@ -21,6 +21,7 @@
 #include "runtime/Context.h"
 #include "runtime/GlobalObject.h"
 #include "runtime/JobQueue.h"
+#include "runtime/VMInstance.h"
 
 #ifdef ESCARGOT_ENABLE_VENDORTEST
 
@@ -29,13 +30,7 @@ namespace Escargot {
 #ifdef ESCARGOT_ENABLE_PROMISE
 static Value builtinDrainJobQueue(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
-    DefaultJobQueue* jobQueue = DefaultJobQueue::get(state.context()->jobQueue());
-    while (jobQueue->hasNextJob()) {
-        auto jobResult = jobQueue->nextJob()->run();
-        if (!jobResult.error.isEmpty())
-            return Value(false);
-    }
-    return Value(true);
+    return Value(state.context()->vmInstance()->drainJobQueue().isEmpty());
 }
 
 static Value builtinAddPromiseReactions(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
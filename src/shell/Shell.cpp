@@ -73,6 +73,27 @@ NEVER_INLINE bool eval(Escargot::Context* context, Escargot::String* str, Escarg
     return true;
 }
 
+static const char* s_profileOutputPath = nullptr;
+
+// writes collapsed stacks of sampling profiler, which can be turned into a flame graph
+// with `flamegraph.pl <file> > out.svg`
+static void finishProfiling(Escargot::VMInstance* instance)
+{
+    if (!s_profileOutputPath) {
+        return;
+    }
+
+    std::string result = instance->stopSamplingProfiler();
+    FILE* fp = fopen(s_profileOutputPath, "w");
+    if (!fp) {
+        fprintf(stderr, "Cannot open profile output file %s\n", s_profileOutputPath);
+        return;
+    }
+    fwrite(result.data(), 1, result.length(), fp);
+    fclose(fp);
+    s_profileOutputPath = nullptr;
+}
+
 int main(int argc, char* argv[])
 {
 #ifndef NDEBUG
@@ -101,14 +122,24 @@ int main(int argc, char* argv[])
                     runShell = true;
                     continue;
                 }
+                if (strncmp(argv[i], "--profile=", 10) == 0) {
+                    s_profileOutputPath = argv[i] + 10;
+                    if (!instance->startSamplingProfiler(1000)) {
+                        fprintf(stderr, "Cannot start sampling profiler\n");
+                        s_profileOutputPath = nullptr;
+                    }
+                    continue;
+                }
             } else { // `-option` case
                 if (strcmp(argv[i], "-e") == 0) {
                     runShell = false;
                     i++;
                     Escargot::String* src = new Escargot::ASCIIString(argv[i], strlen(argv[i]));
                     const char* source = "shell input";
-                    if (!eval(context, src, Escargot::String::fromUTF8(source, strlen(source)), false))
+                    if (!eval(context, src, Escargot::String::fromUTF8(source, strlen(source)), false)) {
+                        finishProfiling(instance);
                         return 3;
+                    }
                     continue;
                 }
                 if (strcmp(argv[i], "-f") == 0) {
@@ -126,8 +157,10 @@ int main(int argc, char* argv[])
             Escargot::Value arg(Escargot::String::fromUTF8(argv[i], strlen(argv[i])));
             Escargot::String* src = Escargot::FunctionObject::call(stateForInit, fnRead, Escargot::Value(), 1, &arg).asString();
 
-            if (!eval(context, src, Escargot::String::fromUTF8(argv[i], strlen(argv[i])), false))
+            if (!eval(context, src, Escargot::String::fromUTF8(argv[i], strlen(argv[i])), false)) {
+                finishProfiling(instance);
                 return 3;
+            }
         } else {
             runShell = false;
             printf("Cannot open file %s\n", argv[i]);
@@ -140,6 +173,7 @@ int main(int argc, char* argv[])
         printf("escargot> ");
         if (!fgets(buf, sizeof buf, stdin)) {
             printf("ERROR: Cannot read interactive shell input\n");
+            finishProfiling(instance);
             return 3;
         }
         auto s = Escargot::utf8StringToUTF16String(buf, strlen(buf));
@@ -147,6 +181,12 @@ int main(int argc, char* argv[])
         eval(context, str, Escargot::String::fromUTF8("from shell input", strlen("from shell input")), true);
     }
 
+    finishProfiling(instance);
+
+    if (getenv("DUMP_PARSER_STATISTICS") && strlen(getenv("DUMP_PARSER_STATISTICS"))) {
+        context->scriptParser().dumpStatistics();
+    }
+
     delete context;
     delete instance;
 
@@ -115,11 +115,10 @@ uint64_t tickCount()
 uint64_t longTickCount()
 {
     struct timeval gettick;
-    unsigned int tick;
-    int ret;
+    uint64_t tick;
     gettimeofday(&gettick, NULL);
 
-    tick = gettick.tv_sec * 1000000 + gettick.tv_usec;
+    tick = (uint64_t)gettick.tv_sec * 1000000 + gettick.tv_usec;
     return tick;
 }
 
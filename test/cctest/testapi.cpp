@@ -16,10 +16,53 @@
 
 #include <EscargotPublic.h>
 #include <string.h>
+#ifdef ESCARGOT_THREADING
+#include <thread>
+#include <vector>
+#endif
 
 #define CHECK(name, cond) \
     printf(name" | %s\n", (cond) ? "pass" : "fail");
 
+static Escargot::ValueRef* evalScript(Escargot::ContextRef* ctx, const char* source)
+{
+    Escargot::ScriptRef* script = ctx->scriptParser()->parse(Escargot::StringRef::fromUTF8(source, strlen(source)), Escargot::StringRef::fromASCII("test.js")).m_script;
+    if (!script) {
+        return nullptr;
+    }
+    Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+    auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+        return script->execute(state);
+    });
+    sb->destroy();
+    return sandBoxResult.result;
+}
+
+#ifdef ESCARGOT_THREADING
+static bool runVMInstanceOnThread(int seed)
+{
+    Escargot::Globals::registerCurrentThread();
+    Escargot::VMInstanceRef* vm = Escargot::VMInstanceRef::create();
+    Escargot::ContextRef* ctx = Escargot::ContextRef::create(vm);
+
+    std::string source = "var arr = []; for (var i = 0; i < 10000; i++) { arr.push({ v: i + " + std::to_string(seed) + " }); }"
+                         "arr.reduce(function(sum, o) { return sum + o.v; }, 0)";
+    Escargot::ScriptRef* script = ctx->scriptParser()->parse(Escargot::StringRef::fromUTF8(source.data(), source.length()), Escargot::StringRef::fromASCII("thread.js")).m_script;
+    Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+    auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+        return script->execute(state);
+    });
+    bool result = sandBoxResult.result && sandBoxResult.result->isNumber()
+        && sandBoxResult.result->asNumber() == 49995000.0 + 10000.0 * seed;
+    sb->destroy();
+
+    ctx->destroy();
+    vm->destroy();
+    Escargot::Globals::unregisterCurrentThread();
+    return result;
+}
+#endif
+
 int main(int argc, char* argv[])
 {
 #ifndef NDEBUG
@@ -173,6 +216,168 @@ int main(int argc, char* argv[])
         sb->destroy();
     }
 
+    {
+        static const char externalSource[] = "'external' + 'String'";
+        Escargot::StringRef* source = Escargot::StringRef::createExternal(externalSource, strlen(externalSource));
+        CHECK("ExternalString 1", source->stringBufferAccessData().buffer == externalSource);
+
+        Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(source, Escargot::StringRef::fromASCII("External.js")).m_script;
+        Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+        auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return scriptRef->execute(state);
+        });
+        CHECK("ExternalString 2", sandBoxResult.result->toString(es)->equals(Escargot::StringRef::fromASCII("externalString")));
+        sb->destroy();
+    }
+
+    {
+        Escargot::ObjectTemplateRef* objectTemplate = Escargot::ObjectTemplateRef::create();
+        objectTemplate->setDataProperty(Escargot::StringRef::fromASCII("x"), Escargot::ValueRef::create(1.5), true, true, true);
+        objectTemplate->setDataProperty(Escargot::StringRef::fromASCII("y"), Escargot::ValueRef::create(2), false, true, true);
+
+        Escargot::ObjectRef* first = objectTemplate->instantiate(es);
+        Escargot::ObjectRef* second = objectTemplate->instantiate(es);
+        first->set(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("x")), Escargot::ValueRef::create(3.5));
+        CHECK("ObjectTemplate 1", first->get(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("x")))->toNumber(es) == 3.5);
+        CHECK("ObjectTemplate 2", second->get(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("x")))->toNumber(es) == 1.5);
+        CHECK("ObjectTemplate 3", !second->set(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("y")), Escargot::ValueRef::create(3)));
+
+        // instances must not share double box of the cached object, because integer stores reuse the box
+        Escargot::ObjectRef* third = objectTemplate->instantiate(es);
+        globalObject->set(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("templateObject")), Escargot::ValueRef::create(third));
+        evalScript(ctx, "templateObject.x = 1; templateObject.x += 0.25;");
+        CHECK("ObjectTemplate 4", third->get(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("x")))->toNumber(es) == 1.25);
+        CHECK("ObjectTemplate 5", objectTemplate->instantiate(es)->get(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("x")))->toNumber(es) == 1.5);
+    }
+
+    {
+        // more properties than ESCARGOT_OBJECT_STRUCTURE_ACCESS_CACHE_BUILD_MIN_SIZE give structure with fast access
+        Escargot::ObjectTemplateRef* objectTemplate = Escargot::ObjectTemplateRef::create();
+        for (int i = 0; i < 120; i++) {
+            std::string name = "p" + std::to_string(i);
+            objectTemplate->setDataProperty(Escargot::StringRef::fromASCII(name.data(), name.length()), Escargot::ValueRef::create(i + 0.5), true, true, true);
+        }
+
+        globalObject->set(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("big1")), Escargot::ValueRef::create(objectTemplate->instantiate(es)));
+        globalObject->set(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("big2")), Escargot::ValueRef::create(objectTemplate->instantiate(es)));
+        evalScript(ctx, "big1.extra = 1; delete big1.p0; delete big1.p50;");
+        CHECK("ObjectTemplate 6", evalScript(ctx, "big1.extra === 1 && !('p0' in big1) && !('p50' in big1) && big1.p51 === 51.5 && big1.p119 === 119.5 && Object.keys(big1).length === 119")->toBoolean(es));
+        CHECK("ObjectTemplate 7", evalScript(ctx, "!('extra' in big2) && big2.p0 === 0.5 && big2.p50 === 50.5 && big2.p51 === 51.5 && big2.p119 === 119.5 && Object.keys(big2).length === 120")->toBoolean(es));
+
+        Escargot::ObjectRef* fresh = objectTemplate->instantiate(es);
+        CHECK("ObjectTemplate 8", fresh->hasOwnProperty(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("p50"))) && !fresh->hasOwnProperty(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("extra"))));
+        CHECK("ObjectTemplate 9", fresh->get(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("p0")))->toNumber(es) == 0.5);
+    }
+
+    {
+        Escargot::AtomicStringRef* names[2] = { Escargot::AtomicStringRef::create(ctx, "a"), Escargot::AtomicStringRef::create(ctx, "b") };
+        Escargot::PropertyNameListRef* list = Escargot::PropertyNameListRef::create(names, 2);
+        Escargot::ObjectRef* obj = Escargot::ObjectRef::create(es);
+        Escargot::ValueRef* values[2] = { Escargot::ValueRef::create(1), Escargot::ValueRef::create(2) };
+        CHECK("PropertyNameList 1", obj->setProperties(es, list, values));
+        values[0] = values[1] = Escargot::ValueRef::createUndefined();
+        obj->getProperties(es, list, values);
+        CHECK("PropertyNameList 2", values[0]->toNumber(es) == 1 && values[1]->toNumber(es) == 2);
+
+        Escargot::ValueRef* keys[1];
+        CHECK("PropertyNameList 3", obj->getOwnEnumerableDataProperties(es, keys, values, 1) == 2);
+        CHECK("PropertyNameList 4", keys[0]->toString(es)->equals(Escargot::StringRef::fromASCII("a")));
+
+        Escargot::ArrayObjectRef* arr = Escargot::ArrayObjectRef::create(es);
+        double elements[3] = { 1, 2.5, 3 };
+        arr->setElements(es, 1, elements, 3);
+        CHECK("ArrayElements 1", arr->get(es, Escargot::ValueRef::create(Escargot::StringRef::fromASCII("length")))->toNumber(es) == 4);
+        CHECK("ArrayElements 2", arr->get(es, Escargot::ValueRef::create(2))->toNumber(es) == 2.5);
+    }
+
+    {
+        std::string emoji = evalScript(ctx, "var pair = 'x'.repeat(30) + '\\ud83d'; pair + '\\ude00'")->toString(es)->toStdUTF8String();
+        CHECK("RopeStringToUTF8 1", emoji == std::string(30, 'x') + "\xF0\x9F\x98\x80");
+    }
+
+    {
+        // small slice is copied out of large string, and large slice still shares its buffer
+        auto parent = evalScript(ctx, "var big8 = 'a'.repeat(100000) + 'b'.repeat(100000); big8")->asString()->stringBufferAccessData();
+        const char* parentBuffer = (const char*)parent.buffer;
+        auto small = evalScript(ctx, "big8.substring(1000, 1100)")->asString()->stringBufferAccessData();
+        auto large = evalScript(ctx, "big8.substring(1000, 101000)")->asString()->stringBufferAccessData();
+        CHECK("StringViewRetention 1", parent.has8BitContent && small.length == 100 && ((const char*)small.buffer < parentBuffer || (const char*)small.buffer >= parentBuffer + parent.length));
+        CHECK("StringViewRetention 2", large.length == 100000 && (const char*)large.buffer == parentBuffer + 1000);
+
+        // slice of view is measured against the root. 19000 is large for the 150000 long view but small for the root
+        evalScript(ctx, "var mid8 = big8.substring(0, 150000)");
+        auto smallOfView = evalScript(ctx, "mid8.substring(1000, 20000)")->asString()->stringBufferAccessData();
+        auto largeOfView = evalScript(ctx, "mid8.substring(2000, 102000)")->asString()->stringBufferAccessData();
+        CHECK("StringViewRetention 3", smallOfView.length == 19000 && ((const char*)smallOfView.buffer < parentBuffer || (const char*)smallOfView.buffer >= parentBuffer + parent.length));
+        CHECK("StringViewRetention 4", largeOfView.length == 100000 && (const char*)largeOfView.buffer == parentBuffer + 2000);
+        CHECK("StringViewRetention 5", evalScript(ctx, "var v = mid8.substring(99000, 149000).substring(500, 1500); v.length === 1000 && v.charAt(0) === 'a' && v.charAt(999) === 'b'")->toBoolean(es));
+    }
+
+    {
+        const char* source = "var s = ''; for (var i = 0; i < 100; i++) { var r = Math.random(); if (r < 0 || r >= 1) throw r; s += r; } s";
+        ctx->setRandomSeed(42);
+        std::string first = evalScript(ctx, source)->toString(es)->toStdUTF8String();
+        ctx->setRandomSeed(42);
+        std::string second = evalScript(ctx, source)->toString(es)->toStdUTF8String();
+        ctx->setRandomSeed(43);
+        std::string third = evalScript(ctx, source)->toString(es)->toStdUTF8String();
+        CHECK("MathRandom 1", first == second);
+        CHECK("MathRandom 2", first != third);
+    }
+
+    if (vm->startSamplingProfiler(500)) {
+        evalScript(ctx, "function hotLoop() { var s = 0; var end = Date.now() + 100; while (Date.now() < end) { s++; } return s; } hotLoop()");
+        std::string profile = vm->stopSamplingProfiler()->toStdUTF8String();
+        CHECK("SamplingProfiler 1", profile.find("hotLoop (") != std::string::npos);
+        CHECK("SamplingProfiler 2", vm->stopSamplingProfiler()->length() == 0);
+    }
+
+#ifdef ESCARGOT_ENABLE_PROMISE
+    {
+        static size_t pendingJobNotified = 0;
+        vm->setPendingJobListener([](Escargot::VMInstanceRef* vm, void* data) {
+            pendingJobNotified++;
+        });
+        evalScript(ctx, "var chainResult = 0; var p = Promise.resolve(0); for (var i = 0; i < 10; i++) { p = p.then(function(v) { chainResult = v + 1; return v + 1; }); }");
+        CHECK("JobQueue 1", pendingJobNotified == 1 && vm->pendingJobCount() == 1);
+        vm->drainJobQueue(3);
+        CHECK("JobQueue 2", evalScript(ctx, "chainResult")->toNumber(es) == 3 && vm->pendingJobCount() == 1);
+        vm->drainJobQueue();
+        CHECK("JobQueue 3", evalScript(ctx, "chainResult")->toNumber(es) == 10 && vm->pendingJobCount() == 0);
+        vm->setPendingJobListener(nullptr);
+    }
+#endif
+
+    {
+        Escargot::VMInstanceRef::GCHeapStatistics heapStatistics = vm->gcHeapStatistics();
+        CHECK("GCHeapStatistics 1", heapStatistics.m_heapSize > 0);
+        CHECK("GCHeapStatistics 2", heapStatistics.m_stringCount > 0);
+        CHECK("GCHeapStatistics 3", heapStatistics.m_liveByteCodeBlockCount <= heapStatistics.m_byteCodeBlockCount);
+
+        Escargot::VMInstanceRef::LiveHeapObjectStatistics liveStatistics = vm->computeLiveHeapObjectStatistics();
+        CHECK("LiveHeapObjectStatistics 1", liveStatistics.m_counts[Escargot::VMInstanceRef::LiveHeapObjectStatistics::OtherKind] > 0);
+        CHECK("LiveHeapObjectStatistics 2", vm->gcPauseTimeHistogram().m_pauseCount > 0);
+    }
+
+#ifdef ESCARGOT_THREADING
+    {
+        const int threadCount = 8;
+        std::vector<std::thread> threads;
+        bool results[threadCount];
+        for (int i = 0; i < threadCount; i++) {
+            threads.push_back(std::thread([i, &results]() {
+                results[i] = runVMInstanceOnThread(i);
+            }));
+        }
+        bool allPassed = true;
+        for (int i = 0; i < threadCount; i++) {
+            threads[i].join();
+            allPassed = allPassed && results[i];
+        }
+        CHECK("VMInstance on threads 1", allPassed);
+    }
+#endif
+
     es->destroy();
     ctx->destroy();
     vm->destroy();
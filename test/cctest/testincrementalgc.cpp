@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2017-present Samsung Electronics Co., Ltd
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <EscargotPublic.h>
+#include <string.h>
+
+#define CHECK(name, cond) \
+    printf(name" | %s\n", (cond) ? "pass" : "fail");
+
+static Escargot::ValueRef* evalScript(Escargot::ContextRef* ctx, const char* source)
+{
+    Escargot::ScriptRef* script = ctx->scriptParser()->parse(Escargot::StringRef::fromUTF8(source, strlen(source)), Escargot::StringRef::fromASCII("test.js")).m_script;
+    if (!script) {
+        return nullptr;
+    }
+    Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+    auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+        return script->execute(state);
+    });
+    sb->destroy();
+    return sandBoxResult.result;
+}
+
+// incremental mode can only be chosen once per process, so it is tested apart from testapi
+int main(int argc, char* argv[])
+{
+#ifndef NDEBUG
+    setbuf(stdout, NULL);
+    setbuf(stderr, NULL);
+#endif
+
+    printf("testincrementalgc begins\n");
+
+    Escargot::Globals::initialize(false, false, true);
+    Escargot::VMInstanceRef* vm = Escargot::VMInstanceRef::create();
+    Escargot::ContextRef* ctx = Escargot::ContextRef::create(vm);
+    Escargot::ExecutionStateRef* es = Escargot::ExecutionStateRef::create(ctx);
+
+    {
+        // live list is mutated while garbage keeps marking going on between allocations
+        vm->resetGCPauseTimeHistogram();
+        size_t gcCount = vm->gcHeapStatistics().m_gcCount;
+        Escargot::ValueRef* result = evalScript(ctx, "var head = null; for (var i = 0; i < 100000; i++) { head = { v: i, next: head }; var garbage = [i, 'g' + i, { i: i }]; if (i % 7 == 0) { head.other = garbage; } }"
+                                                     "var sum = 0; for (var n = head; n; n = n.next) { sum += n.v + (n.other ? n.other[2].i - n.v : 0); } sum");
+        CHECK("IncrementalGC 1", result && result->toNumber(es) == 4999950000.0);
+        CHECK("IncrementalGC 2", vm->gcHeapStatistics().m_gcCount > gcCount);
+
+        Escargot::VMInstanceRef::GCPauseTimeHistogram histogram = vm->gcPauseTimeHistogram();
+        size_t bucketSum = 0;
+        for (size_t i = 0; i < Escargot::VMInstanceRef::GCPauseTimeHistogram::BucketCount; i++) {
+            bucketSum += histogram.m_buckets[i];
+        }
+        CHECK("IncrementalGC 3", histogram.m_pauseCount > 0 && bucketSum == histogram.m_pauseCount);
+        CHECK("IncrementalGC 4", histogram.m_maxPauseTime <= histogram.m_totalPauseTime);
+    }
+
+    es->destroy();
+    ctx->destroy();
+    vm->destroy();
+
+    Escargot::Globals::finalize();
+
+    printf("testincrementalgc ended\n");
+
+    return 0;
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2017-present Samsung Electronics Co., Ltd
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <EscargotPublic.h>
+#include <string.h>
+#include <string>
+
+#ifdef ESCARGOT_THREADING
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+#define CHECK(name, cond) \
+    printf(name" | %s\n", (cond) ? "pass" : "fail");
+
+#ifdef ESCARGOT_THREADING
+static Escargot::ValueRef* evalScript(Escargot::ContextRef* ctx, const char* source)
+{
+    Escargot::ScriptRef* script = ctx->scriptParser()->parse(Escargot::StringRef::fromUTF8(source, strlen(source)), Escargot::StringRef::fromASCII("test.js")).m_script;
+    if (!script) {
+        return nullptr;
+    }
+    Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+    auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+        return script->execute(state);
+    });
+    sb->destroy();
+    return sandBoxResult.result;
+}
+
+// every thread waits here until all of them reach it, so their VMInstances are alive at the same time
+class Barrier {
+public:
+    explicit Barrier(int count)
+        : m_threadCount(count)
+        , m_waitingCount(0)
+        , m_generation(0)
+    {
+    }
+
+    // can be used again once every thread passed it
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        int generation = m_generation;
+        if (++m_waitingCount == m_threadCount) {
+            m_waitingCount = 0;
+            m_generation++;
+            m_condition.notify_all();
+        } else {
+            m_condition.wait(lock, [this, generation] { return m_generation != generation; });
+        }
+    }
+
+private:
+    int m_threadCount;
+    int m_waitingCount;
+    int m_generation;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+};
+
+struct ThreadResult {
+    bool m_keptValue;
+    bool m_allocated;
+};
+
+// each thread owns its VMInstance. garbage made by one thread triggers collections
+// which should scan the stack of the other thread and keep its values alive
+static void runOwnVMInstance(int seed, Barrier* barrier, ThreadResult* result)
+{
+    Escargot::Globals::registerCurrentThread();
+    Escargot::VMInstanceRef* vm = Escargot::VMInstanceRef::create();
+    Escargot::ContextRef* ctx = Escargot::ContextRef::create(vm);
+
+    std::string prepare = "var kept = []; for (var i = 0; i < 1000; i++) { kept.push({ v: i * " + std::to_string(seed) + ", s: 'k' + i }); }";
+    evalScript(ctx, prepare.data());
+    barrier->wait();
+
+    Escargot::ValueRef* allocated = evalScript(ctx, "var sum = 0; for (var i = 0; i < 200000; i++) { var o = { v: i, a: [i, 'g' + i] }; sum += o.a[0] - o.v + 1; } sum");
+    result->m_allocated = allocated && allocated->isNumber() && allocated->asNumber() == 200000.0;
+    barrier->wait();
+
+    std::string check = "var ok = kept.length === 1000; for (var i = 0; i < 1000; i++) { ok = ok && kept[i].v === i * " + std::to_string(seed) + " && kept[i].s === 'k' + i; } ok";
+    Escargot::ValueRef* kept = evalScript(ctx, check.data());
+    result->m_keptValue = kept && kept->isBoolean() && kept->asBoolean();
+
+    ctx->destroy();
+    vm->destroy();
+    Escargot::Globals::unregisterCurrentThread();
+}
+
+static void runBackgroundParse(Escargot::BackgroundParseTaskRef* task)
+{
+    Escargot::Globals::registerCurrentThread();
+    task->run();
+    Escargot::Globals::unregisterCurrentThread();
+}
+
+static std::string backgroundParseSource(int i)
+{
+    // every script has own names and names shared with others, so workers intern both new and existing names
+    std::string id = std::to_string(i);
+    std::string source = "function shared(count) { var total = 0; for (var i = 0; i < count; i++) { total += i; } return total; }";
+    source += "function name" + id + "(value) { var local" + id + " = { key" + id + ": value }; return local" + id + ".key" + id + " + shared(10); }";
+    source += "name" + id + "(" + id + ")";
+    return source;
+}
+#endif
+
+int main(int argc, char* argv[])
+{
+#ifndef NDEBUG
+    setbuf(stdout, NULL);
+    setbuf(stderr, NULL);
+#endif
+
+    printf("testthreads begins\n");
+
+    Escargot::Globals::initialize();
+
+#ifdef ESCARGOT_THREADING
+    {
+        Barrier barrier(2);
+        ThreadResult results[2] = {};
+        std::thread first(runOwnVMInstance, 3, &barrier, &results[0]);
+        std::thread second(runOwnVMInstance, 7, &barrier, &results[1]);
+        first.join();
+        second.join();
+
+        CHECK("TwoThreads 1", results[0].m_allocated && results[1].m_allocated);
+        CHECK("TwoThreads 2", results[0].m_keptValue && results[1].m_keptValue);
+    }
+
+    {
+        Escargot::VMInstanceRef* vm = Escargot::VMInstanceRef::create();
+        Escargot::ContextRef* ctx = Escargot::ContextRef::create(vm);
+
+        const int taskCount = 8;
+        Escargot::BackgroundParseTaskRef* tasks[taskCount + 1];
+        for (int i = 0; i < taskCount; i++) {
+            std::string source = backgroundParseSource(i);
+            tasks[i] = ctx->scriptParser()->createBackgroundParseTask(Escargot::StringRef::fromUTF8(source.data(), source.length()), Escargot::StringRef::fromASCII("background.js"));
+        }
+        tasks[taskCount] = ctx->scriptParser()->createBackgroundParseTask(Escargot::StringRef::fromASCII("var ;"), Escargot::StringRef::fromASCII("error.js"));
+
+        std::vector<std::thread> workers;
+        for (int i = 0; i <= taskCount; i++) {
+            workers.push_back(std::thread(runBackgroundParse, tasks[i]));
+        }
+        // owning thread keeps interning names while workers parse
+        Escargot::ValueRef* interned = evalScript(ctx, "var o = {}; for (var i = 0; i < 20000; i++) { o['key' + (i % 100)] = i; o['main' + i] = i; } Object.keys(o).length");
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        bool allParsed = true;
+        bool allExecuted = true;
+        for (int i = 0; i < taskCount; i++) {
+            Escargot::ScriptRef* script = tasks[i]->finalize().m_script;
+            allParsed = allParsed && script;
+            if (!script) {
+                continue;
+            }
+            Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+            auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+                return script->execute(state);
+            });
+            sb->destroy();
+            allExecuted = allExecuted && sandBoxResult.result && sandBoxResult.result->isNumber() && sandBoxResult.result->asNumber() == i + 45;
+        }
+        auto errorResult = tasks[taskCount]->finalize();
+
+        CHECK("BackgroundParse 1", allParsed);
+        CHECK("BackgroundParse 2", allExecuted);
+        CHECK("BackgroundParse 3", !errorResult.m_script && errorResult.m_error->length());
+        CHECK("BackgroundParse 4", interned && interned->isNumber() && interned->asNumber() == 20100);
+
+        ctx->destroy();
+        vm->destroy();
+    }
+#else
+    printf("testthreads needs ESCARGOT_THREADING, skipped\n");
+#endif
+
+    Escargot::Globals::finalize();
+
+    printf("testthreads ended\n");
+
+    return 0;
+}
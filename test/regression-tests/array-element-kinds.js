@@ -0,0 +1,126 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// SMI -> double -> generic elements
+var a = [1, 2, 3];
+a[1] = 1.5;
+assert(a[0] === 1 && a[1] === 1.5 && a[2] === 3);
+a[0] = 4;
+assert(a.join() === '4,1.5,3');
+a[2] = 'x';
+assert(a.join() === '4,1.5,x');
+a[0] = 0.25;
+a[3] = { v: 1 };
+assert(a[0] === 0.25 && a[1] === 1.5 && a[3].v === 1 && a.length === 4);
+
+var b = [];
+for (var i = 0; i < 100; i++) {
+    b.push(i % 2 ? i + 0.5 : i);
+}
+assert(b[0] === 0 && b[1] === 1.5 && b[98] === 98 && b[99] === 99.5);
+b.push(null);
+assert(b[99] === 99.5 && b[100] === null);
+
+// holes in double elements
+var h = [1.5, , 3.5];
+assert(h.length === 3);
+assert(!(1 in h));
+assert(!h.hasOwnProperty(1));
+assert(h[1] === undefined);
+Array.prototype[1] = 'proto';
+assert(h[1] === 'proto');
+assert(!h.hasOwnProperty(1));
+delete Array.prototype[1];
+assert(h[1] === undefined);
+
+delete h[0];
+assert(!(0 in h) && h[2] === 3.5);
+h[1] = 2.5;
+assert(1 in h && h[1] === 2.5);
+
+var visited = '';
+[0.5, , 2.5].forEach(function(v, i) { visited += i + ':' + v + ';'; });
+assert(visited === '0:0.5;2:2.5;');
+assert(Object.keys([0.5, , 2.5]).join() === '0,2');
+
+// NaN, -0 and 0 / 0 are values, not holes
+var n = [0.5, 0.5, 0.5];
+n[0] = NaN;
+n[1] = -0;
+n[2] = 0 / 0;
+assert(0 in n && n[0] !== n[0]);
+assert(1 in n && n[1] === 0 && 1 / n[1] === -Infinity);
+assert(2 in n && n[2] !== n[2]);
+assert(n.indexOf(NaN) === -1);
+assert(n.join() === 'NaN,0,NaN');
+
+if (typeof Float64Array !== 'undefined' && typeof Uint32Array !== 'undefined') {
+    // every NaN bit pattern, including one looking like internal hole, is kept as NaN
+    var bits = new Uint32Array(4);
+    bits[0] = 0xFFFFFFFF;
+    bits[1] = 0xFFF7FFFF;
+    bits[2] = 0x00000001;
+    bits[3] = 0x7FF00000;
+    var nans = new Float64Array(bits.buffer);
+    var p = [0.5, 0.5];
+    p[0] = nans[0];
+    p[1] = nans[1];
+    assert(0 in p && p[0] !== p[0]);
+    assert(1 in p && p[1] !== p[1]);
+}
+
+// length grow and shrink
+var l = [0.5, 1.5, 2.5];
+l.length = 5;
+assert(l.length === 5 && !(3 in l) && !(4 in l) && l[4] === undefined);
+l.length = 1;
+assert(l.length === 1 && l.join() === '0.5' && l[1] === undefined);
+l.length = 3;
+assert(!(1 in l) && !(2 in l));
+l[2] = 7.25;
+l.push(8.5);
+assert(l.length === 4 && !(1 in l) && l[2] === 7.25 && l[3] === 8.5);
+
+// conversion into non-fast mode keeps values and holes
+var s = [1.5, , 3.5, -0];
+Object.defineProperty(s, 2, { value: 9.5, writable: false });
+assert(s[0] === 1.5 && !(1 in s) && s[2] === 9.5 && 1 / s[3] === -Infinity);
+s[2] = 10;
+assert(s[2] === 9.5);
+var t = [0.5, 1.5];
+t[100000000] = 2.5;
+assert(t.length === 100000001 && t[0] === 0.5 && t[1] === 1.5 && t[100000000] === 2.5 && !(2 in t));
+var u = [0.5, , 2.5];
+Object.defineProperty(u, 'length', { writable: false });
+assert(u[0] === 0.5 && !(1 in u) && u[2] === 2.5);
+u[3] = 1;
+assert(u.length === 3 && !(3 in u));
+
+// sort, concat and slice
+var sorted = [3.5, 1.25, , 2.5, -0.5].sort();
+assert(sorted.length === 5 && sorted.join() === '-0.5,1.25,2.5,3.5,' && !(4 in sorted));
+var numeric = [3.5, NaN, 1.25, 10.5, -1].sort(function(x, y) { return x - y; });
+assert(numeric.length === 5 && numeric.indexOf(10.5) >= 0 && numeric.some(function(v) { return v !== v; }));
+var byNumber = [3.5, 1.25, 10.5, -1].sort(function(x, y) { return x - y; });
+assert(byNumber.join() === '-1,1.25,3.5,10.5');
+
+var c = [1.5, , 2.5].concat([3.5], 4);
+assert(c.length === 5 && !(1 in c) && c.join() === '1.5,,2.5,3.5,4');
+var c2 = [1, 2].concat([0.5, 'x']);
+assert(c2.join() === '1,2,0.5,x');
+
+var sl = [0.5, 1.5, , 3.5].slice(1);
+assert(sl.length === 3 && sl[0] === 1.5 && !(1 in sl) && sl[2] === 3.5);
+assert([0.5, 1.5, 2.5].slice(-2).join() === '1.5,2.5');
@@ -0,0 +1,67 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// a field keeps its double box for integer stores, so no other field may share the box
+var o = { x: 0.5 };
+o.x = 1;
+assert(o.x === 1 && String(o.x) === '1' && (o.x | 0) === 1);
+o.x += 0.25;
+assert(o.x === 1.25);
+o.x = -0;
+assert(1 / o.x === -Infinity);
+o.x = 0;
+assert(1 / o.x === Infinity);
+o.x = 1.25;
+
+var copy = Object.assign({}, o);
+var derived = Object.create(o);
+copy.x = 2;
+copy.x += 0.5;
+assert(o.x === 1.25 && copy.x === 2.5 && derived.x === 1.25);
+o.x = 3;
+assert(copy.x === 2.5 && derived.x === 3);
+derived.x = 4.5;
+assert(o.x === 3 && derived.x === 4.5);
+
+var q = { a: 0.5, b: 0 };
+q.b = q.a;
+q.a = 1;
+q.a += 0.25;
+assert(q.a === 1.25 && q.b === 0.5);
+
+var r = { a: 1.5 };
+var s = { a: r.a };
+r.a = 2;
+r.a += 0.5;
+assert(r.a === 2.5 && s.a === 1.5);
+
+function Point(x) {
+    this.x = x;
+}
+var points = [];
+for (var i = 0; i < 10; i++) {
+    points.push(new Point(0.5));
+}
+points[0].x = 1;
+points[0].x += 0.25;
+for (var i = 1; i < points.length; i++) {
+    assert(points[i].x === 0.5);
+}
+
+var parsed = JSON.parse('{"v":0.5}');
+var cloned = JSON.parse(JSON.stringify(parsed));
+parsed.v = 1;
+parsed.v += 0.25;
+assert(parsed.v === 1.25 && cloned.v === 0.5);
@@ -0,0 +1,38 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var keys = '';
+var recs = [{ a: 1, b: 2, c: 3 }, { a: 4, b: 5, c: 6 }];
+for (var i = 0; i < recs.length; i++) {
+    for (var k in recs[i]) {
+        keys += k;
+        delete recs[i].c;
+    }
+}
+assert(keys === 'abab');
+
+Object.prototype.x = 1;
+var s = '';
+for (var k in { a: 1 }) {
+    s += k;
+}
+delete Object.prototype.x;
+assert(s === 'ax');
+
+var o = { p: 1, q: 2 };
+assert(Object.keys(o).join() === 'p,q');
+assert(Object.values(o).join() === '1,2');
+assert(Object.entries(o).join() === 'p,1,q,2');
+assert(JSON.stringify(o) === '{"p":1,"q":2}');
@@ -0,0 +1,83 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+function self() { 'use strict'; return this; }
+function count() { return arguments.length; }
+function pair(a, b) { return this.base + a * 10 + b; }
+
+// Function.prototype.call
+assert(self.call() === undefined);
+assert(count.call() === 0);
+assert(count.call(null) === 0);
+assert(pair.call({ base: 100 }, 1, 2) === 112);
+assert(isNaN(pair.call({ base: 100 }, 1)));
+var receiver = {};
+assert(self.call(receiver, 1, 2) === receiver);
+var callRef = self.call;
+assert(callRef.call(self, receiver) === receiver);
+
+// constructors which require new throw even if they are called through call
+var thrown = null;
+try {
+    Map.call({});
+} catch (e) {
+    thrown = e;
+}
+assert(thrown instanceof TypeError);
+
+// bound function without and with bound arguments
+function Point(x, y) { this.x = x; this.y = y; this.sum = this.base + x + y; }
+Point.prototype.base = 1000;
+var unbound = pair.bind({ base: 200 });
+assert(unbound(3, 4) === 234);
+assert(unbound.call({ base: 900 }, 3, 4) === 234);
+var partial = pair.bind({ base: 300 }, 5);
+assert(partial(6) === 356);
+assert(partial.apply(null, [7]) === 357);
+var twice = partial.bind(null);
+assert(twice(8) === 358);
+
+var BoundPoint = Point.bind({ base: 0 });
+var p = new BoundPoint(1, 2);
+assert(p instanceof Point);
+assert(p.sum === 1003);
+var PartialPoint = Point.bind({ base: 0 }, 10);
+p = new PartialPoint(20);
+assert(p instanceof Point);
+assert(p.x === 10 && p.y === 20 && p.sum === 1030);
+
+// apply on holey array reads holes through the prototype chain
+function list() { return Array.prototype.slice.call(arguments).join(','); }
+var holey = [1, , 3];
+Object.defineProperty(Array.prototype, 1, {
+    get: function () { holey[2] = 30; return 2; },
+    configurable: true
+});
+assert(list.apply(null, holey) === '1,2,30');
+delete Array.prototype[1];
+assert(list.apply(null, [1, , 3]) === '1,,3');
+
+// apply with mapped arguments follows reassigned parameters
+function forward(a, b) {
+    a = 'x';
+    return list.apply(this, arguments);
+}
+assert(forward(1, 2, 3) === 'x,2,3');
+function forwardStrict(a, b) {
+    'use strict';
+    a = 'x';
+    return list.apply(this, arguments);
+}
+assert(forwardStrict(1, 2, 3) === '1,2,3');
@@ -0,0 +1,25 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+if (typeof Intl !== 'undefined') {
+    var collator = new Intl.Collator('en');
+    var words = ['b', 'C', 'a', 'B', 'c', 'A', 1, undefined, 'b'];
+    assert(words.slice().sort(collator.compare).join() === words.slice().sort(function(a, b) { return collator.compare(a, b); }).join());
+    assert(new Intl.Collator('en').compare('a', 'B') === collator.compare('a', 'B'));
+
+    var format1 = new Intl.NumberFormat('en', { maximumFractionDigits: 1 }).format(1.25);
+    assert(format1 === new Intl.NumberFormat('en', { maximumFractionDigits: 1 }).format(1.25));
+    assert(format1 !== new Intl.NumberFormat('en', { maximumFractionDigits: 2 }).format(1.25));
+}
@@ -0,0 +1,58 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+assert(JSON.stringify([{ a: 'x"\n\u0001yyyyyyyy', b: [1, 2.5, null, undefined, function() {}], c: undefined, d: true }, {}, [], NaN])
+       === '[{"a":"x\\"\\n\\u0001yyyyyyyy","b":[1,2.5,null,null,null],"d":true},{},[],null]');
+assert(JSON.stringify({ k\u0100: '\u0101', n: [new Number(3)], t: { toJSON: function() { return 7; } } })
+       === '{"k\u0100":"\u0101","n":[3],"t":7}');
+
+var cyclic = { a: [1] };
+cyclic.a.push(cyclic);
+var thrown = false;
+try {
+    JSON.stringify(cyclic);
+} catch (e) {
+    thrown = e instanceof TypeError;
+}
+assert(thrown);
+
+// toJSON found past Object.prototype is still called. engines with immutable Object.prototype throw instead
+function stringifyWithObjectPrototypeParent(parent) {
+    try {
+        Object.setPrototypeOf(Object.prototype, parent);
+    } catch (e) {
+        assert(e instanceof TypeError);
+        return null;
+    }
+    try {
+        return JSON.stringify({ a: 1 }) + JSON.stringify([1, 2]);
+    } finally {
+        Object.setPrototypeOf(Object.prototype, null);
+    }
+}
+
+var parent = Object.create(null);
+parent.toJSON = function() { return 1; };
+var result = stringifyWithObjectPrototypeParent(parent);
+assert(result === null || result === '11');
+if (typeof Proxy !== 'undefined') {
+    var proxyParent = new Proxy(Object.create(null), {
+        get: function(target, key) { return key === 'toJSON' ? function() { return 2; } : undefined; }
+    });
+    result = stringifyWithObjectPrototypeParent(proxyParent);
+    assert(result === null || result === '22');
+}
+assert(Object.getPrototypeOf(Object.prototype) === null);
+assert(JSON.stringify({ a: 1 }) === '{"a":1}');
@@ -0,0 +1,28 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+function f() { 'use strict'; return arguments.length * 10 + arguments[1]; }
+assert(f(1, 2, 3) === 32);
+
+function g() { 'use strict'; var a = arguments; return a.length + arguments[0]; }
+assert(g(5, 6) === 7);
+
+function h() { arguments[0] = 9; return arguments[0] + arguments.length; }
+assert(h(1) === 10);
+
+Object.prototype[3] = 4;
+function k() { 'use strict'; return arguments[3]; }
+assert(k(1) === 4);
+delete Object.prototype[3];
@@ -0,0 +1,26 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+assert([-2147483648, 9007199254740991, -9007199254740991, 1e21, 0.1, -1.5e-7, 123456789012].join()
+       === '-2147483648,9007199254740991,-9007199254740991,1e+21,0.1,-1.5e-7,123456789012');
+
+assert((12).toFixed() === '12');
+assert((-12).toFixed(2) === '-12.00');
+assert((-0).toFixed(1) === '0.0');
+assert((1.005).toFixed(2) === '1.00');
+assert((123).toPrecision(5) === '123.00');
+assert((-123).toPrecision(3) === '-123');
+assert((123).toPrecision(2) === '1.2e+2');
+assert((0).toPrecision(3) === '0.00');
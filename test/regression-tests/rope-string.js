@@ -0,0 +1,35 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var rope = '';
+for (var i = 0; i < 3000; i++) {
+    rope += 'ab' + (i % 10);
+}
+
+assert(rope.charAt(0) + rope.charAt(4000) + rope.charCodeAt(8999) + rope[3] === 'ab57a');
+
+assert(rope.startsWith('ab0ab1'));
+assert(rope.endsWith('ab8ab9'));
+assert(rope.startsWith('ab4', 12));
+assert(!rope.startsWith('ab5', 12));
+
+var flat = rope.split('').join('');
+var rope2 = rope + 'z';
+var o = {};
+o[rope2] = 1;
+assert(rope2 === flat + 'z');
+assert(o[flat + 'z'] === 1);
+assert(rope2 < flat + 'zz');
+assert(!(rope2 < flat));
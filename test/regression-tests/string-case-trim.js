@@ -0,0 +1,24 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+assert('Content-Type-Header-Name'.toLowerCase() === 'content-type-header-name');
+assert('accept-encoding'.toLowerCase() === 'accept-encoding');
+assert('abcdefghijklmnopqrstuvwxyz@[`{'.toUpperCase() === 'ABCDEFGHIJKLMNOPQRSTUVWXYZ@[`{');
+assert('ABCDEFGHIJKLMNOPQRSTUVWXYZ@[`{'.toLowerCase() === 'abcdefghijklmnopqrstuvwxyz@[`{');
+
+assert('  \t\u00a0abc \n'.trim() === 'abc');
+assert('abc'.trim() === 'abc');
+assert(' \u3000'.trim() === '');
+assert('\u3000a\u3000b\u3000'.trim() === 'a\u3000b');
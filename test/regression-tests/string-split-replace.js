@@ -0,0 +1,29 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+assert(JSON.stringify('a,b,,c,'.split(',')) === '["a","b","","c",""]');
+assert('key=value; path=/; HttpOnly'.split('; ').join('|') === 'key=value|path=/|HttpOnly');
+assert('a--b--c'.split('--', 2).join() === 'a,b');
+assert('abc'.split('').join() === 'a,b,c');
+assert('\u3042,\u3044'.split(',').length === 2);
+assert('abc'.split('\u3042')[0] === 'abc');
+assert('x'.split('x').length === 2);
+
+assert('hello world'.replace('world', 'there') === 'hello there');
+assert('aaa'.replace('a', 'b') === 'baa');
+assert('abc'.replace('x', 'y') === 'abc');
+assert('abc'.replace('b', '[$&]') === 'a[b]c');
+assert('abc'.replace('b', '\u3042') === 'a\u3042c');
+assert('abc'.replace('abc', '') === '');
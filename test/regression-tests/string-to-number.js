@@ -0,0 +1,35 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+assert([+' 42 ', +'12.34', +'-0.5e2', +'0x1F', +'0b101', +'0o17', +'1e', +'+0x1', +'', +'.', +'-Infinity', 1 / +'-0'].join()
+       === '42,12.34,-50,31,5,15,NaN,NaN,0,NaN,-Infinity,-Infinity');
+
+assert(+'0.1' === 0.1);
+assert(+'9007199254740993' === 9007199254740992);
+assert(+'2.2250738585072014e-308' === 2.2250738585072014e-308);
+assert(+'1e400' === Infinity);
+
+assert([parseFloat('  3.5abc'), parseFloat('1e5x'), parseFloat('1ex'), parseFloat('-.5'), parseFloat('0x10'), parseFloat('Infinityx'), parseFloat('.e1'), parseInt('123456789012345678901'), parseInt('-ff', 16)].join()
+       === '3.5,100000,1,-0.5,0,Infinity,NaN,123456789012345680000,-255');
+
+// long binary, octal and hex literals are rounded once, to nearest even
+assert(+('0b1' + '0'.repeat(52) + '11') === Math.pow(2, 54) + 4);
+assert(+('0b1' + '0'.repeat(52) + '1') === Math.pow(2, 53));
+assert(+('0b1' + '0'.repeat(51) + '11') === Math.pow(2, 53) + 4);
+assert(+('0b1' + '0'.repeat(52) + '1' + '0'.repeat(20) + '1') === Math.pow(2, 74) + Math.pow(2, 22));
+assert(+('0o1' + '0'.repeat(17) + '1') === Math.pow(2, 54));
+assert(+('0o1' + '0'.repeat(17) + '3') === Math.pow(2, 54) + 4);
+assert(+'0x20000000000003' === Math.pow(2, 53) + 4);
+assert(+('0x' + 'f'.repeat(300)) === Infinity);
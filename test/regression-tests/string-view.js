@@ -0,0 +1,35 @@
+/* Copyright 2019-present Samsung Electronics Co., Ltd. and other contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+var big = 'a'.repeat(100000) + 'xyz' + 'b'.repeat(100000) + '\u3042'.repeat(100000);
+
+assert(big.substring(100000, 100043) === 'xyz' + 'b'.repeat(40));
+assert(big.slice(200003, 200050) === '\u3042'.repeat(47));
+
+var half = big.substring(0, 150000);
+assert(half.length === 150000);
+assert(half.substring(99999, 100050) === 'axyz' + 'b'.repeat(47));
+
+var m = /x(y)z(b{40})/.exec(big);
+assert(m[0] === 'xyz' + 'b'.repeat(40));
+assert(m[1] === 'y');
+assert((' ' + m[2] + ' ').trim() === m[2]);
+
+// view of view reads the right part of the root string
+var quarter = half.substring(75000, 112500);
+assert(quarter.length === 37500);
+assert(quarter.substring(24990, 25010) === 'a'.repeat(10) + 'xyz' + 'b'.repeat(7));
+var inner = big.substring(199000, 201000).substring(990, 1010);
+assert(inner === 'b'.repeat(13) + '\u3042'.repeat(7));